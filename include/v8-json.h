@@ -5,12 +5,17 @@
 #ifndef INCLUDE_V8_JSON_H_
 #define INCLUDE_V8_JSON_H_
 
+#include <stddef.h>
+#include <stdint.h>
+
 #include "v8-local-handle.h"  // NOLINT(build/include_directory)
+#include "v8-maybe.h"         // NOLINT(build/include_directory)
 #include "v8config.h"         // NOLINT(build/include_directory)
 
 namespace v8 {
 
 class Context;
+class Isolate;
 class Value;
 class String;
 
@@ -40,6 +45,47 @@ class V8_EXPORT JSON {
   static V8_WARN_UNUSED_RESULT MaybeLocal<String> Stringify(
       Local<Context> context, Local<Value> json_object,
       Local<String> gap = Local<String>());
+
+  /**
+   * Parses UTF-8 encoded JSON text that arrives in chunks, e.g. from the
+   * network, without materializing the whole text as a string first.
+   *
+   * If the text is an array, each element is parsed as soon as its text is
+   * complete, and the text is released. Only the text of the current element
+   * is buffered in addition to the elements parsed so far. Each element is
+   * copied into a string and parsed on its own, so this trades some speed
+   * for memory; it is slower than JSON::Parse for arrays of many small
+   * elements. Any other value is buffered in full and then copied into a
+   * string by Finish, so its text is held twice while it is parsed. Syntax
+   * errors inside an array element report positions relative to the start of
+   * that element.
+   */
+  class V8_EXPORT StreamingParser {
+   public:
+    explicit StreamingParser(Isolate* isolate);
+    ~StreamingParser();
+
+    /**
+     * Consumes the next chunk of text. The chunk is not referenced after
+     * this returns. Returns Nothing if an exception was thrown, after which
+     * the parser must not be used anymore.
+     */
+    V8_WARN_UNUSED_RESULT Maybe<bool> Write(Local<Context> context,
+                                            const uint8_t* data,
+                                            size_t length);
+
+    /**
+     * Returns the parsed value, once all chunks have been written.
+     */
+    V8_WARN_UNUSED_RESULT MaybeLocal<Value> Finish(Local<Context> context);
+
+    StreamingParser(const StreamingParser&) = delete;
+    void operator=(const StreamingParser&) = delete;
+
+   private:
+    struct PrivateData;
+    PrivateData* private_;
+  };
 };
 
 }  // namespace v8
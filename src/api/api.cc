@@ -75,6 +75,7 @@
 #include "src/init/startup-data-util.h"
 #include "src/init/v8.h"
 #include "src/json/json-parser.h"
+#include "src/json/json-streaming-parser.h"
 #include "src/json/json-stringifier.h"
 #include "src/logging/counters-scopes.h"
 #include "src/logging/metrics.h"
@@ -3398,6 +3399,40 @@ MaybeLocal<String> JSON::Stringify(Local<Context> context,
   RETURN_ESCAPED(result);
 }
 
+struct JSON::StreamingParser::PrivateData {
+  explicit PrivateData(i::Isolate* i_isolate) : parser(i_isolate) {}
+  i::JsonStreamingParser parser;
+};
+
+JSON::StreamingParser::StreamingParser(Isolate* v8_isolate)
+    : private_(new PrivateData(reinterpret_cast<i::Isolate*>(v8_isolate))) {}
+
+JSON::StreamingParser::~StreamingParser() { delete private_; }
+
+Maybe<bool> JSON::StreamingParser::Write(Local<Context> context,
+                                         const uint8_t* data, size_t length) {
+  auto i_isolate = reinterpret_cast<i::Isolate*>(context->GetIsolate());
+  Utils::ApiCheck(!private_->parser.has_failed(),
+                  "v8::JSON::StreamingParser::Write",
+                  "The parser has already failed");
+  ENTER_V8(i_isolate, context, JSON_StreamingParser, Write, i::HandleScope);
+  has_exception =
+      !private_->parser.Write(base::Vector<const uint8_t>(data, length));
+  RETURN_ON_FAILED_EXECUTION_PRIMITIVE(bool);
+  return Just(true);
+}
+
+MaybeLocal<Value> JSON::StreamingParser::Finish(Local<Context> context) {
+  Utils::ApiCheck(!private_->parser.has_failed(),
+                  "v8::JSON::StreamingParser::Finish",
+                  "The parser has already failed");
+  PREPARE_FOR_EXECUTION(context, JSON_StreamingParser, Finish);
+  Local<Value> result;
+  has_exception = !ToLocal<Value>(private_->parser.Finish(), &result);
+  RETURN_ON_FAILED_EXECUTION(Value);
+  RETURN_ESCAPED(result);
+}
+
 // --- V a l u e   S e r i a l i z a t i o n ---
 
 SharedValueConveyor::SharedValueConveyor(SharedValueConveyor&& other) noexcept
@@ -382,6 +382,7 @@ bool CPU::StarboardDetectCPU() {
       has_avx_ = features.x86.has_avx;
       has_avx2_ = features.x86.has_avx2;
       // TODO: Support AVX-VNNI on Starboard
+      // TODO: Support AVX-512 on Starboard
       has_fma3_ = features.x86.has_fma3;
       has_bmi1_ = features.x86.has_bmi1;
       has_bmi2_ = features.x86.has_bmi2;
@@ -429,6 +430,8 @@ CPU::CPU()
       has_avx2_(false),
       has_avx_vnni_(false),
       has_avx_vnni_int8_(false),
+      has_avx512f_(false),
+      has_avx512vl_(false),
       has_fma3_(false),
       has_f16c_(false),
       has_bmi1_(false),
@@ -515,6 +518,8 @@ CPU::CPU()
     has_avx2_ = (cpu_info70[1] & 0x00000020) != 0;
     has_avx_vnni_ = (cpu_info71[0] & 0x00000010) != 0;
     has_avx_vnni_int8_ = (cpu_info71[3] & 0x00000020) != 0;
+    has_avx512f_ = (cpu_info70[1] & 0x00010000) != 0;
+    has_avx512vl_ = (cpu_info70[1] & 0x80000000) != 0;
     has_fma3_ = (cpu_info[2] & 0x00001000) != 0;
     has_f16c_ = (cpu_info[2] & 0x20000000) != 0;
     // CET shadow stack feature flag. See
@@ -87,6 +87,8 @@ class V8_BASE_EXPORT CPU final {
   bool has_avx2() const { return has_avx2_; }
   bool has_avx_vnni() const { return has_avx_vnni_; }
   bool has_avx_vnni_int8() const { return has_avx_vnni_int8_; }
+  bool has_avx512f() const { return has_avx512f_; }
+  bool has_avx512vl() const { return has_avx512vl_; }
   bool has_fma3() const { return has_fma3_; }
   bool has_f16c() const { return has_f16c_; }
   bool has_bmi1() const { return has_bmi1_; }
@@ -175,6 +177,8 @@ class V8_BASE_EXPORT CPU final {
   bool has_avx2_;
   bool has_avx_vnni_;
   bool has_avx_vnni_int8_;
+  bool has_avx512f_;
+  bool has_avx512vl_;
   bool has_fma3_;
   bool has_f16c_;
   bool has_bmi1_;
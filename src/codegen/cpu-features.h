@@ -23,6 +23,7 @@ enum CpuFeature {
   AVX2,
   AVX_VNNI,
   AVX_VNNI_INT8,
+  AVX512,  // AVX-512 F + VL
   FMA3,
   BMI1,
   BMI2,
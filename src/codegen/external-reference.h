@@ -342,6 +342,7 @@ enum class IsolateFieldId : uint8_t;
   IF_WASM(V, wasm_memory_fill, "wasm::memory_fill")                            \
   IF_WASM(V, wasm_array_copy, "wasm::array_copy")                              \
   IF_WASM(V, wasm_array_fill, "wasm::array_fill")                              \
+  IF_WASM(V, wasm_array_init_data, "wasm::array_init_data")                    \
   IF_WASM(V, wasm_string_to_f64, "wasm_string_to_f64")                         \
   IF_WASM(V, wasm_atomic_notify, "wasm_atomic_notify")                         \
   IF_WASM(V, wasm_signature_check_fail, "wasm_signature_check_fail")           \
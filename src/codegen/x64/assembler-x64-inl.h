@@ -192,6 +192,20 @@ void Assembler::emit_vex_prefix(Register reg, Register vreg, Operand rm,
   emit_vex_prefix(ireg, ivreg, rm, l, pp, mm, w);
 }
 
+void Assembler::emit_evex_prefix(XMMRegister reg, XMMRegister vreg,
+                                 XMMRegister rm, VectorLength l, SIMDPrefix pp,
+                                 LeadingOpcode mm, VexW w) {
+  emit(0x62);
+  // P0: inverted R, X, B and R' bits, followed by the opcode map.
+  uint8_t rxb = static_cast<uint8_t>(~((reg.high_bit() << 2) | rm.high_bit()))
+                << 5;
+  emit(rxb | 0x10 | mm);
+  // P1: W, inverted vvvv, a fixed 1 bit and the implied prefix.
+  emit(w | ((~vreg.code() & 0xf) << 3) | 0x04 | pp);
+  // P2: vector length and the inverted V' bit; no masking or broadcast.
+  emit((l == kL256 ? 0x20 : 0x00) | 0x08);
+}
+
 Address Assembler::target_address_at(Address pc, Address constant_pool) {
   return ReadUnalignedValue<int32_t>(pc) + pc + 4;
 }
@@ -72,6 +72,13 @@ bool OSHasAVXSupport() {
   return (feature_mask & 0x6) == 0x6;
 }
 
+bool OSHasAVX512Support() {
+  // The OS has to save the opmask registers and the upper halves of the zmm
+  // registers in addition to the AVX state.
+  uint64_t feature_mask = xgetbv(0);  // XCR_XFEATURE_ENABLED_MASK
+  return (feature_mask & 0xE6) == 0xE6;
+}
+
 #endif  // V8_HOST_ARCH_IA32 || V8_HOST_ARCH_X64
 
 }  // namespace
@@ -103,6 +110,9 @@ void CpuFeatures::ProbeImpl(bool cross_compile) {
     if (cpu.has_avx2()) SetSupported(AVX2);
     if (cpu.has_avx_vnni()) SetSupported(AVX_VNNI);
     if (cpu.has_avx_vnni_int8()) SetSupported(AVX_VNNI_INT8);
+    if (cpu.has_avx512f() && cpu.has_avx512vl() && OSHasAVX512Support()) {
+      SetSupported(AVX512);
+    }
     if (cpu.has_fma3()) SetSupported(FMA3);
   }
 
@@ -133,6 +143,7 @@ void CpuFeatures::ProbeImpl(bool cross_compile) {
   if (!v8_flags.enable_avx_vnni || !IsSupported(AVX)) SetUnsupported(AVX_VNNI);
   if (!v8_flags.enable_avx_vnni_int8 || !IsSupported(AVX))
     SetUnsupported(AVX_VNNI_INT8);
+  if (!v8_flags.enable_avx512 || !IsSupported(AVX2)) SetUnsupported(AVX512);
   if (!v8_flags.enable_fma3 || !IsSupported(AVX)) SetUnsupported(FMA3);
   if (!v8_flags.enable_f16c || !IsSupported(AVX)) SetUnsupported(F16C);
 
@@ -154,6 +165,7 @@ void CpuFeatures::PrintFeatures() {
   printf(
       "SSE3=%d SSSE3=%d SSE4_1=%d SSE4_2=%d SAHF=%d AVX=%d AVX2=%d AVX_VNNI=%d "
       "AVX_VNNI_INT8=%d "
+      "AVX512=%d "
       "FMA3=%d "
       "F16C=%d "
       "BMI1=%d "
@@ -164,7 +176,8 @@ void CpuFeatures::PrintFeatures() {
       CpuFeatures::IsSupported(SSE4_1), CpuFeatures::IsSupported(SSE4_2),
       CpuFeatures::IsSupported(SAHF), CpuFeatures::IsSupported(AVX),
       CpuFeatures::IsSupported(AVX2), CpuFeatures::IsSupported(AVX_VNNI),
-      CpuFeatures::IsSupported(AVX_VNNI_INT8), CpuFeatures::IsSupported(FMA3),
+      CpuFeatures::IsSupported(AVX_VNNI_INT8), CpuFeatures::IsSupported(AVX512),
+      CpuFeatures::IsSupported(FMA3),
       CpuFeatures::IsSupported(F16C), CpuFeatures::IsSupported(BMI1),
       CpuFeatures::IsSupported(BMI2), CpuFeatures::IsSupported(LZCNT),
       CpuFeatures::IsSupported(POPCNT), CpuFeatures::IsSupported(INTEL_ATOM));
@@ -3948,6 +3961,16 @@ template EXPORT_TEMPLATE_DEFINE(V8_EXPORT_PRIVATE) void Assembler::vinstr(
     uint8_t op, YMMRegister dst, XMMRegister src1, YMMRegister src2,
     SIMDPrefix pp, LeadingOpcode m, VexW w, CpuFeature feature);
 
+void Assembler::evex_instr(uint8_t op, XMMRegister dst, XMMRegister src1,
+                           XMMRegister src2, VectorLength l, SIMDPrefix pp,
+                           LeadingOpcode m, VexW w) {
+  DCHECK(IsEnabled(AVX512));
+  EnsureSpace ensure_space(this);
+  emit_evex_prefix(dst, src1, src2, l, pp, m, w);
+  emit(op);
+  emit_sse_operand(dst, src2);
+}
+
 void Assembler::vps(uint8_t op, XMMRegister dst, XMMRegister src1,
                     XMMRegister src2) {
   DCHECK(IsEnabled(AVX));
@@ -1249,6 +1249,10 @@ class V8_EXPORT_PRIVATE Assembler : public AssemblerBase {
   void vinstr(uint8_t op, Reg1 dst, Reg2 src1, Op src2, SIMDPrefix pp,
               LeadingOpcode m, VexW w, CpuFeature feature = AVX2);
 
+  void evex_instr(uint8_t op, XMMRegister dst, XMMRegister src1,
+                  XMMRegister src2, VectorLength l, SIMDPrefix pp,
+                  LeadingOpcode m, VexW w);
+
   // SSE instructions
   void sse_instr(XMMRegister dst, XMMRegister src, uint8_t escape,
                  uint8_t opcode);
@@ -2290,6 +2294,22 @@ class V8_EXPORT_PRIVATE Assembler : public AssemblerBase {
     vinstr(0x50, dst, src1, src2, kF2, k0F38, kW0, AVX_VNNI_INT8);
   }
 
+  // AVX-512 instructions
+  void vpsraq(XMMRegister dst, XMMRegister src, uint8_t imm8) {
+    evex_instr(0x72, xmm4, dst, src, kL128, k66, k0F, kW1);
+    emit(imm8);
+  }
+  void vpsraq(YMMRegister dst, YMMRegister src, uint8_t imm8) {
+    evex_instr(0x72, ymm4, dst, src, kL256, k66, k0F, kW1);
+    emit(imm8);
+  }
+  void vpsraq(XMMRegister dst, XMMRegister src, XMMRegister count) {
+    evex_instr(0xE2, dst, src, count, kL128, k66, k0F, kW1);
+  }
+  void vpsraq(YMMRegister dst, YMMRegister src, XMMRegister count) {
+    evex_instr(0xE2, dst, src, count, kL256, k66, k0F, kW1);
+  }
+
   // BMI instruction
   void andnq(Register dst, Register src1, Register src2) {
     bmi1q(0xf2, dst, src1, src2);
@@ -2669,6 +2689,12 @@ class V8_EXPORT_PRIVATE Assembler : public AssemblerBase {
                               VectorLength l, SIMDPrefix pp, LeadingOpcode m,
                               VexW w);
 
+  // Emit evex prefix. Only the 128- and 256-bit vector lengths of AVX512VL,
+  // without masking, broadcast or embedded rounding are supported.
+  inline void emit_evex_prefix(XMMRegister reg, XMMRegister v, XMMRegister rm,
+                               VectorLength l, SIMDPrefix pp, LeadingOpcode m,
+                               VexW w);
+
   // Emit the ModR/M byte, and optionally the SIB byte and
   // 1- or 4-byte offset for a memory operand.  Also encodes
   // the second operand of the operation, a register or operation
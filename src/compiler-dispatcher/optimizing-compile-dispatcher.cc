@@ -4,6 +4,9 @@
 
 #include "src/compiler-dispatcher/optimizing-compile-dispatcher.h"
 
+#include <cmath>
+#include <limits>
+
 #include "src/base/atomicops.h"
 #include "src/codegen/compiler.h"
 #include "src/codegen/optimized-compilation-info.h"
@@ -15,7 +18,7 @@
 #include "src/logging/counters.h"
 #include "src/logging/log.h"
 #include "src/logging/runtime-call-stats-scope.h"
-#include "src/objects/js-function.h"
+#include "src/objects/js-function-inl.h"
 #include "src/tasks/cancelable-task.h"
 #include "src/tracing/trace-event.h"
 
@@ -84,7 +87,13 @@ OptimizingCompileDispatcher::~OptimizingCompileDispatcher() {
 
 TurbofanCompilationJob* OptimizingCompileDispatcher::NextInput(
     LocalIsolate* local_isolate) {
-  return input_queue_.Dequeue();
+  base::TimeDelta queued_time;
+  TurbofanCompilationJob* job = input_queue_.Dequeue(&queued_time);
+  if (job) {
+    isolate_->counters()->turbofan_optimize_queue_latency()->AddTimedSample(
+        queued_time);
+  }
+  return job;
 }
 
 void OptimizingCompileDispatcher::CompileNext(TurbofanCompilationJob* job,
@@ -121,10 +130,87 @@ void OptimizingCompileDispatcher::FlushOutputQueue() {
   }
 }
 
+TurbofanCompilationJob* OptimizingCompileDispatcherQueue::Dequeue(
+    base::TimeDelta* queued_time, base::TimeTicks now) {
+  base::MutexGuard access(&mutex_);
+  if (length_ == 0) return nullptr;
+  int index = 0;
+  if (prioritize_) {
+    double best = AgedBenefit(queue_[QueueIndex(0)], now);
+    for (int i = 1; i < length_; ++i) {
+      double benefit = AgedBenefit(queue_[QueueIndex(i)], now);
+      if (benefit > best) {
+        index = i;
+        best = benefit;
+      }
+    }
+  }
+  Entry entry = queue_[QueueIndex(index)];
+  DCHECK_NOT_NULL(entry.job);
+  RemoveAt(index);
+  if (queued_time) *queued_time = now - entry.enqueue_time;
+  return entry.job;
+}
+
+void OptimizingCompileDispatcherQueue::RemoveAt(int index) {
+  DCHECK_LT(index, length_);
+  for (int i = index; i > 0; --i) {
+    queue_[QueueIndex(i)] = queue_[QueueIndex(i - 1)];
+  }
+  shift_ = QueueIndex(1);
+  length_--;
+}
+
+// static
+double OptimizingCompileDispatcherQueue::AgedBenefit(const Entry& entry,
+                                                     base::TimeTicks now) {
+  double age_ms = (now - entry.enqueue_time).InMillisecondsF();
+  return entry.benefit * (1.0 + std::max(0.0, age_ms) / kBenefitAgingTimeMs);
+}
+
+// static
+int OptimizingCompileDispatcherQueue::InvocationCount(
+    TurbofanCompilationJob* job) {
+  Tagged<JSFunction> function = *job->compilation_info()->closure();
+  return function->has_feedback_vector()
+             ? function->feedback_vector()->invocation_count()
+             : 0;
+}
+
+void OptimizingCompileDispatcherQueue::UpdateBenefits(Isolate* isolate,
+                                                      base::TimeTicks now) {
+  if (!prioritize_) return;
+  base::MutexGuard access(&mutex_);
+  for (int i = length_ - 1; i >= 0; --i) {
+    Entry& entry = queue_[QueueIndex(i)];
+    if (entry.job->compilation_info()->is_osr()) continue;
+    int invocation_count = InvocationCount(entry.job);
+    if (invocation_count != entry.invocation_count) {
+      entry.invocation_count = invocation_count;
+      entry.last_invocation_time = now;
+    } else if ((now - entry.last_invocation_time).InMilliseconds() >=
+               kColdTimeMs) {
+      std::unique_ptr<TurbofanCompilationJob> job(entry.job);
+      RemoveAt(i);
+      if (v8_flags.trace_concurrent_recompilation) {
+        PrintF("  ** Dropping queued compilation of ");
+        ShortPrint(*job->compilation_info()->closure());
+        PrintF(" as it is no longer hot.\n");
+      }
+      Compiler::DisposeTurbofanCompilationJob(isolate, job.get());
+      continue;
+    }
+    // Prioritized entries keep their infinite benefit.
+    if (std::isfinite(entry.benefit)) {
+      entry.benefit = OptimizingCompileDispatcher::EstimateBenefit(entry.job);
+    }
+  }
+}
+
 void OptimizingCompileDispatcherQueue::Flush(Isolate* isolate) {
   base::MutexGuard access(&mutex_);
   while (length_ > 0) {
-    std::unique_ptr<TurbofanCompilationJob> job(queue_[QueueIndex(0)]);
+    std::unique_ptr<TurbofanCompilationJob> job(queue_[QueueIndex(0)].job);
     DCHECK_NOT_NULL(job);
     shift_ = QueueIndex(1);
     length_--;
@@ -214,8 +300,11 @@ bool OptimizingCompileDispatcher::HasJobs() {
 
 void OptimizingCompileDispatcher::QueueForOptimization(
     TurbofanCompilationJob* job) {
+  input_queue_.UpdateBenefits(isolate_);
   DCHECK(input_queue_.IsAvailable());
-  input_queue_.Enqueue(job);
+  input_queue_.Enqueue(job, EstimateBenefit(job));
+  isolate_->counters()->turbofan_optimize_queue_length()->AddSample(
+      input_queue_.Length());
   if (job_handle_->UpdatePriorityEnabled()) {
     job_handle_->UpdatePriority(isolate_->EfficiencyModeEnabledForTiering()
                                     ? kEfficiencyTaskPriority
@@ -227,9 +316,19 @@ void OptimizingCompileDispatcher::QueueForOptimization(
 void OptimizingCompileDispatcherQueue::Prioritize(
     Tagged<SharedFunctionInfo> function) {
   base::MutexGuard access(&mutex_);
+  if (prioritize_) {
+    for (int i = 0; i < length_; ++i) {
+      Entry& entry = queue_[QueueIndex(i)];
+      if (*entry.job->compilation_info()->shared_info() == function) {
+        entry.benefit = std::numeric_limits<double>::infinity();
+        return;
+      }
+    }
+    return;
+  }
   if (length_ > 1) {
     for (int i = length_ - 1; i > 1; --i) {
-      if (*queue_[QueueIndex(i)]->compilation_info()->shared_info() ==
+      if (*queue_[QueueIndex(i)].job->compilation_info()->shared_info() ==
           function) {
         std::swap(queue_[QueueIndex(i)], queue_[QueueIndex(0)]);
         return;
@@ -243,9 +342,20 @@ void OptimizingCompileDispatcher::Prioritize(
   input_queue_.Prioritize(function);
 }
 
+// static
+double OptimizingCompileDispatcher::EstimateBenefit(
+    TurbofanCompilationJob* job) {
+  OptimizedCompilationInfo* info = job->compilation_info();
+  if (info->is_osr()) return std::numeric_limits<double>::infinity();
+  int invocations = OptimizingCompileDispatcherQueue::InvocationCount(job);
+  int compile_cost = std::max(1, info->bytecode_array()->length());
+  return (1.0 + invocations) / compile_cost;
+}
+
 OptimizingCompileDispatcher::OptimizingCompileDispatcher(Isolate* isolate)
     : isolate_(isolate),
-      input_queue_(v8_flags.concurrent_recompilation_queue_length),
+      input_queue_(v8_flags.concurrent_recompilation_queue_length,
+                   v8_flags.concurrent_recompilation_prioritize),
       recompilation_delay_(v8_flags.concurrent_recompilation_delay) {
   if (v8_flags.concurrent_recompilation) {
     job_handle_ = V8::GetCurrentPlatform()->PostJob(
@@ -10,6 +10,7 @@
 
 #include "src/base/platform/condition-variable.h"
 #include "src/base/platform/mutex.h"
+#include "src/base/platform/time.h"
 #include "src/common/globals.h"
 #include "src/flags/flags.h"
 #include "src/heap/parked-scope.h"
@@ -23,7 +24,12 @@ class TurbofanCompilationJob;
 class RuntimeCallStats;
 class SharedFunctionInfo;
 
-// Circular queue of incoming recompilation tasks (including OSR).
+// Circular queue of incoming recompilation tasks (including OSR). If
+// {prioritize} is set, jobs are dequeued in order of decreasing estimated
+// benefit (see OptimizingCompileDispatcher::EstimateBenefit), and in FIFO
+// order among jobs of equal benefit. The benefit of a queued job grows with
+// the time it has spent in the queue, so that low-benefit jobs are not
+// starved by a steady stream of hotter ones.
 class V8_EXPORT OptimizingCompileDispatcherQueue {
  public:
   inline bool IsAvailable() {
@@ -36,35 +42,66 @@ class V8_EXPORT OptimizingCompileDispatcherQueue {
     return length_;
   }
 
-  explicit OptimizingCompileDispatcherQueue(int capacity)
-      : capacity_(capacity), length_(0), shift_(0) {
-    queue_ = NewArray<TurbofanCompilationJob*>(capacity_);
+  explicit OptimizingCompileDispatcherQueue(int capacity,
+                                            bool prioritize = false)
+      : capacity_(capacity), length_(0), shift_(0), prioritize_(prioritize) {
+    queue_ = NewArray<Entry>(capacity_);
   }
 
   ~OptimizingCompileDispatcherQueue() { DeleteArray(queue_); }
 
-  TurbofanCompilationJob* Dequeue() {
-    base::MutexGuard access(&mutex_);
-    if (length_ == 0) return nullptr;
-    TurbofanCompilationJob* job = queue_[QueueIndex(0)];
-    DCHECK_NOT_NULL(job);
-    shift_ = QueueIndex(1);
-    length_--;
-    return job;
-  }
+  // Returns the next job to compile, or nullptr if the queue is empty. If
+  // {queued_time} is non-null, it is set to the time the job spent queued.
+  TurbofanCompilationJob* Dequeue(
+      base::TimeDelta* queued_time = nullptr,
+      base::TimeTicks now = base::TimeTicks::Now());
 
-  void Enqueue(TurbofanCompilationJob* job) {
+  void Enqueue(TurbofanCompilationJob* job, double benefit = 0,
+               base::TimeTicks now = base::TimeTicks::Now()) {
     base::MutexGuard access(&mutex_);
     DCHECK_LT(length_, capacity_);
-    queue_[QueueIndex(length_)] = job;
+    queue_[QueueIndex(length_)] = {job, benefit, now,
+                                   InvocationCount(job), now};
     length_++;
   }
 
   void Flush(Isolate* isolate);
 
+  // Re-estimates the benefit of all queued jobs from the current invocation
+  // counts, and disposes of non-OSR jobs whose function has not been invoked
+  // for kColdTimeMs while queued. Must be called on the main thread.
+  void UpdateBenefits(Isolate* isolate,
+                      base::TimeTicks now = base::TimeTicks::Now());
+
+  // Current invocation count of the function compiled by {job}.
+  static int InvocationCount(TurbofanCompilationJob* job);
+
+  // Queued jobs gain their initial benefit once more every
+  // kBenefitAgingTimeMs.
+  static constexpr int kBenefitAgingTimeMs = 10;
+  // Queued jobs of functions that went cold for this long are dropped.
+  static constexpr int kColdTimeMs = 500;
+
   void Prioritize(Tagged<SharedFunctionInfo> function);
 
  private:
+  struct Entry {
+    TurbofanCompilationJob* job;
+    double benefit;
+    base::TimeTicks enqueue_time;
+    // Invocation count of the function when last observed by
+    // UpdateBenefits, and the time it was last seen to change.
+    int invocation_count;
+    base::TimeTicks last_invocation_time;
+  };
+
+  // Benefit of {entry} aged by the time it has spent in the queue.
+  static double AgedBenefit(const Entry& entry, base::TimeTicks now);
+
+  // Removes the entry at {index}, keeping the remaining entries in FIFO
+  // order. The caller must hold {mutex_}.
+  void RemoveAt(int index);
+
   inline int QueueIndex(int i) {
     int result = (i + shift_) % capacity_;
     DCHECK_LE(0, result);
@@ -72,10 +109,11 @@ class V8_EXPORT OptimizingCompileDispatcherQueue {
     return result;
   }
 
-  TurbofanCompilationJob** queue_;
+  Entry* queue_;
   int capacity_;
   int length_;
   int shift_;
+  const bool prioritize_;
   base::Mutex mutex_;
 };
 
@@ -110,6 +148,12 @@ class V8_EXPORT_PRIVATE OptimizingCompileDispatcher {
 
   void Prioritize(Tagged<SharedFunctionInfo> function);
 
+  // Estimated benefit of running {job} before other queued jobs: the number
+  // of invocations that will profit from the optimized code per unit of
+  // compile cost, where compile cost is approximated by the bytecode size.
+  // OSR jobs have a running loop waiting on them and always go first.
+  static double EstimateBenefit(TurbofanCompilationJob* job);
+
  private:
   class CompileTask;
 
@@ -4,6 +4,8 @@
 
 #include "src/compiler/backend/instruction-scheduler.h"
 
+#include <algorithm>
+
 namespace v8 {
 namespace internal {
 namespace compiler {
@@ -560,6 +562,201 @@ int InstructionScheduler::GetInstructionLatency(const Instruction* instr) {
   }
 }
 
+int InstructionScheduler::GetTargetInstructionLatency(
+    const Instruction* instr) const {
+  // Latencies from the Arm Neoverse N1 software optimization guide, for
+  // register operands. Loads pay the load-to-use latency on top.
+  DCHECK_EQ(machine_model_.cpu, SchedulerCpuModel::kArmNeoverse);
+  int latency;
+  switch (instr->arch_opcode()) {
+    case kArm64Add:
+    case kArm64Add32:
+    case kArm64And:
+    case kArm64And32:
+    case kArm64Bic:
+    case kArm64Bic32:
+    case kArm64Cmn:
+    case kArm64Cmn32:
+    case kArm64Cmp:
+    case kArm64Cmp32:
+    case kArm64Eon:
+    case kArm64Eon32:
+    case kArm64Eor:
+    case kArm64Eor32:
+    case kArm64Not:
+    case kArm64Not32:
+    case kArm64Or:
+    case kArm64Or32:
+    case kArm64Orn:
+    case kArm64Orn32:
+    case kArm64Sub:
+    case kArm64Sub32:
+    case kArm64Tst:
+    case kArm64Tst32:
+      // Shifted or extended register operands take an extra cycle.
+      latency = instr->addressing_mode() != kMode_None ? 2 : 1;
+      break;
+    case kArm64LdrDecompressTaggedSigned:
+    case kArm64LdrDecompressTagged:
+    case kArm64LdrDecompressProtected:
+    case kArm64Ldr:
+    case kArm64LdrW:
+    case kArm64Ldrb:
+    case kArm64Ldrh:
+    case kArm64Ldrsb:
+    case kArm64Ldrsh:
+    case kArm64Ldrsw:
+      latency = 4;
+      break;
+    case kArm64LdrD:
+    case kArm64LdrS:
+      latency = 5;
+      break;
+    case kArm64Madd32:
+    case kArm64Mneg32:
+    case kArm64Msub32:
+    case kArm64Mul32:
+    case kArm64Madd:
+    case kArm64Mneg:
+    case kArm64Msub:
+    case kArm64Mul:
+      latency = 2;
+      break;
+    case kArm64Smulh:
+    case kArm64Umulh:
+      latency = 3;
+      break;
+    case kArm64Idiv32:
+    case kArm64Udiv32:
+      latency = 12;
+      break;
+    case kArm64Idiv:
+    case kArm64Udiv:
+      latency = 20;
+      break;
+    case kArm64Float32Add:
+    case kArm64Float32Sub:
+    case kArm64Float64Add:
+    case kArm64Float64Sub:
+    case kArm64Float32Abs:
+    case kArm64Float32Neg:
+    case kArm64Float64Abs:
+    case kArm64Float64Neg:
+    case kArm64Float32Cmp:
+    case kArm64Float64Cmp:
+    case kArm64Float32Max:
+    case kArm64Float32Min:
+    case kArm64Float64Max:
+    case kArm64Float64Min:
+      latency = 2;
+      break;
+    case kArm64Float32Mul:
+    case kArm64Float64Mul:
+      latency = 3;
+      break;
+    case kArm64Float32Div:
+      latency = 10;
+      break;
+    case kArm64Float64Div:
+      latency = 15;
+      break;
+    case kArm64Float32Sqrt:
+      latency = 12;
+      break;
+    case kArm64Float64Sqrt:
+      latency = 17;
+      break;
+    default:
+      // Fall back to the generic estimate for everything we have no better
+      // number for.
+      return GetInstructionLatency(instr);
+  }
+  return std::max(latency, 1);
+}
+
+SchedulerResource InstructionScheduler::GetTargetInstructionResource(
+    const Instruction* instr) const {
+  switch (instr->arch_opcode()) {
+    case kArm64Add:
+    case kArm64Add32:
+    case kArm64And:
+    case kArm64And32:
+    case kArm64Bic:
+    case kArm64Bic32:
+    case kArm64Cmn:
+    case kArm64Cmn32:
+    case kArm64Cmp:
+    case kArm64Cmp32:
+    case kArm64Eon:
+    case kArm64Eon32:
+    case kArm64Eor:
+    case kArm64Eor32:
+    case kArm64Not:
+    case kArm64Not32:
+    case kArm64Or:
+    case kArm64Or32:
+    case kArm64Orn:
+    case kArm64Orn32:
+    case kArm64Sub:
+    case kArm64Sub32:
+    case kArm64Tst:
+    case kArm64Tst32:
+    case kArm64Lsl:
+    case kArm64Lsl32:
+    case kArm64Lsr:
+    case kArm64Lsr32:
+    case kArm64Asr:
+    case kArm64Asr32:
+    case kArm64Ror:
+    case kArm64Ror32:
+    case kArm64Sxtb32:
+    case kArm64Sxth32:
+    case kArm64Sxtw:
+    case kArm64Ubfx:
+    case kArm64Ubfx32:
+    case kArm64Sbfx:
+    case kArm64Sbfx32:
+      return SchedulerResource::kAlu;
+    case kArm64Madd32:
+    case kArm64Mneg32:
+    case kArm64Msub32:
+    case kArm64Mul32:
+    case kArm64Madd:
+    case kArm64Mneg:
+    case kArm64Msub:
+    case kArm64Mul:
+    case kArm64Smulh:
+    case kArm64Umulh:
+      return SchedulerResource::kMul;
+    case kArm64Idiv32:
+    case kArm64Udiv32:
+    case kArm64Idiv:
+    case kArm64Udiv:
+      return SchedulerResource::kDiv;
+    case kArm64Float32Add:
+    case kArm64Float32Sub:
+    case kArm64Float64Add:
+    case kArm64Float64Sub:
+    case kArm64Float32Cmp:
+    case kArm64Float64Cmp:
+    case kArm64Float32Max:
+    case kArm64Float32Min:
+    case kArm64Float64Max:
+    case kArm64Float64Min:
+      return SchedulerResource::kFpAdd;
+    case kArm64Float32Mul:
+    case kArm64Float64Mul:
+      return SchedulerResource::kFpMul;
+    case kArm64Float32Div:
+    case kArm64Float64Div:
+    case kArm64Float32Sqrt:
+    case kArm64Float64Sqrt:
+      return SchedulerResource::kFpDiv;
+    default:
+      return SchedulerResource::kUnconstrained;
+  }
+}
+
 }  // namespace compiler
 }  // namespace internal
 }  // namespace v8
@@ -4,8 +4,10 @@
 
 #include "src/compiler/backend/instruction-scheduler.h"
 
+#include <cstring>
 #include <optional>
 
+#include "src/base/cpu.h"
 #include "src/base/iterator.h"
 #include "src/base/utils/random-number-generator.h"
 #include "src/compiler/backend/instruction-codes.h"
@@ -31,8 +33,10 @@ InstructionScheduler::CriticalPathFirstQueue::PopBestCandidate(int cycle) {
   DCHECK(!IsEmpty());
   auto candidate = nodes_.end();
   for (auto iterator = nodes_.begin(); iterator != nodes_.end(); ++iterator) {
-    // We only consider instructions that have all their operands ready.
-    if (cycle >= (*iterator)->start_cycle()) {
+    // We only consider instructions that have all their operands ready and
+    // for which an execution unit is still free in this cycle.
+    if (cycle >= (*iterator)->start_cycle() &&
+        scheduler_->HasFreeUnit(*iterator)) {
       candidate = iterator;
       break;
     }
@@ -59,12 +63,13 @@ InstructionScheduler::StressSchedulerQueue::PopBestCandidate(int cycle) {
   return result;
 }
 
-InstructionScheduler::ScheduleGraphNode::ScheduleGraphNode(Zone* zone,
-                                                           Instruction* instr)
+InstructionScheduler::ScheduleGraphNode::ScheduleGraphNode(
+    Zone* zone, Instruction* instr, int latency, SchedulerResource resource)
     : instr_(instr),
       successors_(zone),
       unscheduled_predecessors_count_(0),
-      latency_(GetInstructionLatency(instr)),
+      latency_(latency),
+      resource_(resource),
       total_latency_(-1),
       start_cycle_(-1) {}
 
@@ -78,7 +83,9 @@ InstructionScheduler::InstructionScheduler(Zone* zone,
                                            InstructionSequence* sequence)
     : zone_(zone),
       sequence_(sequence),
+      machine_model_(GetMachineModel()),
       graph_(zone),
+      busy_units_{},
       last_side_effect_instr_(nullptr),
       pending_loads_(zone),
       last_live_in_reg_marker_(nullptr),
@@ -90,6 +97,107 @@ InstructionScheduler::InstructionScheduler(Zone* zone,
   }
 }
 
+namespace {
+
+// Issue width and units for ALU, multiply, divide, FP add, FP multiply,
+// FP divide, load and store, in the order of SchedulerResource. The generic
+// model issues one instruction per cycle, so its units never saturate.
+constexpr SchedulerMachineModel kGenericModel = {
+    SchedulerCpuModel::kGeneric, 1, {1, 1, 1, 1, 1, 1, 1, 1, 1}};
+constexpr SchedulerMachineModel kIntelSkylakeModel = {
+    SchedulerCpuModel::kIntelSkylake, 4, {0, 4, 1, 1, 2, 2, 1, 2, 1}};
+constexpr SchedulerMachineModel kAmdZenModel = {
+    SchedulerCpuModel::kAmdZen, 5, {0, 4, 1, 1, 2, 2, 1, 3, 1}};
+constexpr SchedulerMachineModel kArmNeoverseModel = {
+    SchedulerCpuModel::kArmNeoverse, 4, {0, 3, 1, 1, 2, 2, 1, 2, 1}};
+
+SchedulerCpuModel DetectCpuModel() {
+  // Only trust the host CPU when we are generating code for it.
+#if V8_HOST_ARCH_X64 && V8_TARGET_ARCH_X64
+  base::CPU cpu;
+  return InstructionScheduler::CpuModelForX64(
+      cpu.vendor(), cpu.family() + cpu.ext_family(), cpu.model());
+#elif V8_HOST_ARCH_ARM64 && V8_TARGET_ARCH_ARM64
+  return SchedulerCpuModel::kArmNeoverse;
+#else
+  return SchedulerCpuModel::kGeneric;
+#endif
+}
+
+SchedulerCpuModel SelectCpuModel() {
+  const char* name = v8_flags.turbo_instruction_scheduling_cpu;
+  if (strcmp(name, "auto") == 0) {
+    static const SchedulerCpuModel detected = DetectCpuModel();
+    return detected;
+  }
+#if V8_TARGET_ARCH_X64
+  if (strcmp(name, "skylake") == 0) return SchedulerCpuModel::kIntelSkylake;
+  if (strcmp(name, "zen") == 0) return SchedulerCpuModel::kAmdZen;
+#elif V8_TARGET_ARCH_ARM64
+  if (strcmp(name, "neoverse") == 0) return SchedulerCpuModel::kArmNeoverse;
+#endif
+  return SchedulerCpuModel::kGeneric;
+}
+
+}  // namespace
+
+// static
+SchedulerCpuModel InstructionScheduler::CpuModelForX64(const char* vendor,
+                                                       int family,
+                                                       int model) {
+  if (strcmp(vendor, "GenuineIntel") == 0 && family == 0x6) {
+    switch (model) {
+      case 0x4E:  // Skylake
+      case 0x5E:
+      case 0x55:  // Skylake-SP, Cascade Lake, Cooper Lake
+      case 0x8E:  // Kaby Lake, Whiskey Lake, Amber Lake, Comet Lake
+      case 0x9E:  // Kaby Lake, Coffee Lake
+      case 0xA5:  // Comet Lake
+      case 0xA6:
+      case 0x66:  // Cannon Lake
+      case 0x7D:  // Ice Lake
+      case 0x7E:
+      case 0x6A:
+      case 0x6C:
+      case 0x8C:  // Tiger Lake
+      case 0x8D:
+      case 0xA7:  // Rocket Lake
+      case 0x8F:  // Sapphire Rapids
+      case 0xCF:  // Emerald Rapids
+      case 0x97:  // Alder Lake
+      case 0x9A:
+      case 0xB7:  // Raptor Lake
+      case 0xBA:
+      case 0xBF:
+        // Sunny Cove and later cores are wider than Skylake, but still much
+        // closer to it than to the generic model.
+        return SchedulerCpuModel::kIntelSkylake;
+      default:
+        // Older cores and Atom-class cores have a different port layout.
+        return SchedulerCpuModel::kGeneric;
+    }
+  }
+  if (strcmp(vendor, "AuthenticAMD") == 0 && family >= 0x17) {
+    return SchedulerCpuModel::kAmdZen;
+  }
+  return SchedulerCpuModel::kGeneric;
+}
+
+// static
+const SchedulerMachineModel& InstructionScheduler::GetMachineModel() {
+  switch (SelectCpuModel()) {
+    case SchedulerCpuModel::kGeneric:
+      return kGenericModel;
+    case SchedulerCpuModel::kIntelSkylake:
+      return kIntelSkylakeModel;
+    case SchedulerCpuModel::kAmdZen:
+      return kAmdZenModel;
+    case SchedulerCpuModel::kArmNeoverse:
+      return kArmNeoverseModel;
+  }
+  UNREACHABLE();
+}
+
 void InstructionScheduler::StartBlock(RpoNumber rpo) {
   DCHECK(graph_.empty());
   DCHECK_NULL(last_side_effect_instr_);
@@ -110,7 +218,7 @@ void InstructionScheduler::EndBlock(RpoNumber rpo) {
 }
 
 void InstructionScheduler::AddTerminator(Instruction* instr) {
-  ScheduleGraphNode* new_node = zone()->New<ScheduleGraphNode>(zone(), instr);
+  ScheduleGraphNode* new_node = NewScheduleGraphNode(instr);
   // Make sure that basic block terminators are not moved by adding them
   // as successor of every instruction.
   for (ScheduleGraphNode* node : graph_) {
@@ -130,7 +238,7 @@ void InstructionScheduler::AddInstruction(Instruction* instr) {
     return;
   }
 
-  ScheduleGraphNode* new_node = zone()->New<ScheduleGraphNode>(zone(), instr);
+  ScheduleGraphNode* new_node = NewScheduleGraphNode(instr);
 
   // We should not have branches in the middle of a block.
   DCHECK_NE(instr->flags_mode(), kFlags_branch);
@@ -210,6 +318,13 @@ void InstructionScheduler::AddInstruction(Instruction* instr) {
   graph_.push_back(new_node);
 }
 
+InstructionScheduler::ScheduleGraphNode*
+InstructionScheduler::NewScheduleGraphNode(Instruction* instr) {
+  return zone()->New<ScheduleGraphNode>(zone(), instr,
+                                        GetModelInstructionLatency(instr),
+                                        GetInstructionResource(instr));
+}
+
 template <typename QueueType>
 void InstructionScheduler::Schedule() {
   QueueType ready_list(this);
@@ -224,13 +339,20 @@ void InstructionScheduler::Schedule() {
     }
   }
 
-  // Go through the ready list and schedule the instructions.
+  // Go through the ready list and schedule the instructions. Up to
+  // issue_width instructions are issued per cycle, as long as their execution
+  // units are not saturated.
   int cycle = 0;
+  int issued = 0;
+  busy_units_.fill(0);
   while (!ready_list.IsEmpty()) {
     ScheduleGraphNode* candidate = ready_list.PopBestCandidate(cycle);
 
     if (candidate != nullptr) {
       sequence()->AddInstruction(candidate->instruction());
+      busy_units_[static_cast<int>(candidate->resource())]++;
+      issued++;
+      candidate->set_start_cycle(cycle);
 
       for (ScheduleGraphNode* successor : candidate->successors()) {
         successor->DropUnscheduledPredecessor();
@@ -243,7 +365,11 @@ void InstructionScheduler::Schedule() {
       }
     }
 
-    cycle++;
+    if (candidate == nullptr || issued == machine_model_.issue_width) {
+      cycle++;
+      issued = 0;
+      busy_units_.fill(0);
+    }
   }
 
   // Reset own state.
@@ -405,6 +531,41 @@ int InstructionScheduler::GetInstructionFlags(const Instruction* instr) const {
   UNREACHABLE();
 }
 
+int InstructionScheduler::GetModelInstructionLatency(
+    const Instruction* instr) const {
+  if (machine_model_.cpu == SchedulerCpuModel::kGeneric) {
+    return GetInstructionLatency(instr);
+  }
+  return GetTargetInstructionLatency(instr);
+}
+
+SchedulerResource InstructionScheduler::GetInstructionResource(
+    const Instruction* instr) const {
+  if (machine_model_.cpu == SchedulerCpuModel::kGeneric) {
+    return SchedulerResource::kUnconstrained;
+  }
+  // Barriers are never part of the scheduling graph. Memory operations are
+  // bound by the load and store ports rather than by the arithmetic they may
+  // fold in.
+  if (IsLoadOperation(instr)) return SchedulerResource::kLoad;
+  if (HasSideEffect(instr)) return SchedulerResource::kStore;
+  return GetTargetInstructionResource(instr);
+}
+
+#if !V8_TARGET_ARCH_X64 && !V8_TARGET_ARCH_ARM64
+// Only x64 and arm64 provide microarchitecture-specific tables; other targets
+// always use the generic model.
+int InstructionScheduler::GetTargetInstructionLatency(
+    const Instruction* instr) const {
+  return GetInstructionLatency(instr);
+}
+
+SchedulerResource InstructionScheduler::GetTargetInstructionResource(
+    const Instruction* instr) const {
+  return SchedulerResource::kUnconstrained;
+}
+#endif  // !V8_TARGET_ARCH_X64 && !V8_TARGET_ARCH_ARM64
+
 void InstructionScheduler::ComputeTotalLatencies() {
   for (ScheduleGraphNode* node : base::Reversed(graph_)) {
     int max_latency = 0;
@@ -5,6 +5,7 @@
 #ifndef V8_COMPILER_BACKEND_INSTRUCTION_SCHEDULER_H_
 #define V8_COMPILER_BACKEND_INSTRUCTION_SCHEDULER_H_
 
+#include <array>
 #include <optional>
 
 #include "src/base/utils/random-number-generator.h"
@@ -32,6 +33,41 @@ enum ArchOpcodeFlags {
                    // across such an instruction.
 };
 
+// Microarchitectures for which the backend provides dedicated latency and
+// throughput tables. kGeneric uses the empirically determined latencies of
+// GetInstructionLatency() and issues a single instruction per cycle.
+enum class SchedulerCpuModel : uint8_t {
+  kGeneric,
+  kIntelSkylake,
+  kAmdZen,
+  kArmNeoverse,
+};
+
+// Classes of execution units an instruction competes for. Instructions which
+// are kUnconstrained never wait for a free unit.
+enum class SchedulerResource : uint8_t {
+  kUnconstrained,
+  kAlu,
+  kMul,
+  kDiv,
+  kFpAdd,
+  kFpMul,
+  kFpDiv,
+  kLoad,
+  kStore,
+};
+static constexpr int kSchedulerResourceCount =
+    static_cast<int>(SchedulerResource::kStore) + 1;
+
+// Issue width and per-resource throughput of a modelled core. Units are
+// assumed to be fully pipelined, i.e. each of them can start a new instruction
+// every cycle.
+struct SchedulerMachineModel {
+  SchedulerCpuModel cpu;
+  int issue_width;
+  std::array<int, kSchedulerResourceCount> units;
+};
+
 class InstructionScheduler final : public ZoneObject {
  public:
   V8_EXPORT_PRIVATE InstructionScheduler(Zone* zone,
@@ -45,12 +81,23 @@ class InstructionScheduler final : public ZoneObject {
 
   static bool SchedulerSupported();
 
+  // Return the machine model the scheduler uses on this host, as selected by
+  // --turbo-instruction-scheduling-cpu.
+  V8_EXPORT_PRIVATE static const SchedulerMachineModel& GetMachineModel();
+
+  // Map an x64 host CPU, as reported by cpuid, to the closest machine model.
+  // {family} includes the extended family.
+  V8_EXPORT_PRIVATE static SchedulerCpuModel CpuModelForX64(const char* vendor,
+                                                            int family,
+                                                            int model);
+
  private:
   // A scheduling graph node.
   // Represent an instruction and their dependencies.
   class ScheduleGraphNode : public ZoneObject {
    public:
-    ScheduleGraphNode(Zone* zone, Instruction* instr);
+    ScheduleGraphNode(Zone* zone, Instruction* instr, int latency,
+                      SchedulerResource resource);
 
     // Mark the instruction represented by 'node' as a dependency of this one.
     // The current instruction will be registered as an unscheduled predecessor
@@ -71,6 +118,7 @@ class InstructionScheduler final : public ZoneObject {
     Instruction* instruction() { return instr_; }
     ZoneDeque<ScheduleGraphNode*>& successors() { return successors_; }
     int latency() const { return latency_; }
+    SchedulerResource resource() const { return resource_; }
 
     int total_latency() const { return total_latency_; }
     void set_total_latency(int latency) { total_latency_ = latency; }
@@ -89,6 +137,9 @@ class InstructionScheduler final : public ZoneObject {
     // instruction to complete).
     int latency_;
 
+    // The class of execution unit this instruction needs to be issued.
+    SchedulerResource resource_;
+
     // The sum of all the latencies on the path from this node to the end of
     // the graph (i.e. a node with no successor).
     int total_latency_;
@@ -96,7 +147,8 @@ class InstructionScheduler final : public ZoneObject {
     // The scheduler keeps a nominal cycle count to keep track of when the
     // result of an instruction is available. This field is updated by the
     // scheduler to indicate when the value of all the operands of this
-    // instruction will be available.
+    // instruction will be available. Once the instruction is issued, it holds
+    // the cycle it was issued in.
     int start_cycle_;
   };
 
@@ -151,6 +203,16 @@ class InstructionScheduler final : public ZoneObject {
   template <typename QueueType>
   void Schedule();
 
+  ScheduleGraphNode* NewScheduleGraphNode(Instruction* instr);
+
+  // Check whether a unit able to execute the given node is still available in
+  // the current cycle.
+  bool HasFreeUnit(const ScheduleGraphNode* node) const {
+    if (node->resource() == SchedulerResource::kUnconstrained) return true;
+    int index = static_cast<int>(node->resource());
+    return busy_units_[index] < machine_model_.units[index];
+  }
+
   // Return the scheduling properties of the given instruction.
   V8_EXPORT_PRIVATE int GetInstructionFlags(const Instruction* instr) const;
   int GetTargetInstructionFlags(const Instruction* instr) const;
@@ -209,6 +271,15 @@ class InstructionScheduler final : public ZoneObject {
 
   static int GetInstructionLatency(const Instruction* instr);
 
+  // Latency and execution unit of the instruction on the selected machine
+  // model. Only targets with microarchitecture-specific tables override the
+  // generic latencies.
+  int GetModelInstructionLatency(const Instruction* instr) const;
+  SchedulerResource GetInstructionResource(const Instruction* instr) const;
+  int GetTargetInstructionLatency(const Instruction* instr) const;
+  SchedulerResource GetTargetInstructionResource(
+      const Instruction* instr) const;
+
   Zone* zone() { return zone_; }
   InstructionSequence* sequence() { return sequence_; }
   base::RandomNumberGenerator* random_number_generator() {
@@ -217,8 +288,13 @@ class InstructionScheduler final : public ZoneObject {
 
   Zone* zone_;
   InstructionSequence* sequence_;
+  const SchedulerMachineModel& machine_model_;
   ZoneVector<ScheduleGraphNode*> graph_;
 
+  // Number of instructions of each resource class issued in the current
+  // cycle.
+  std::array<int, kSchedulerResourceCount> busy_units_;
+
   friend class InstructionSchedulerTester;
 
   // Last side effect instruction encountered while building the graph.
@@ -4545,6 +4545,8 @@ void InstructionSelectorT<TurbofanAdapter>::VisitNode(Node* node) {
       return MarkAsSimd256(node), VisitI8x32Neg(node);
     case IrOpcode::kI64x4Shl:
       return MarkAsSimd256(node), VisitI64x4Shl(node);
+    case IrOpcode::kI64x4ShrS:
+      return MarkAsSimd256(node), VisitI64x4ShrS(node);
     case IrOpcode::kI64x4ShrU:
       return MarkAsSimd256(node), VisitI64x4ShrU(node);
     case IrOpcode::kI32x8Shl:
@@ -4775,10 +4775,20 @@ CodeGenerator::CodeGenResult CodeGenerator::AssembleArchInstruction(
           }
           case kL64: {
             // I64x2ShrS
-            // TODO(zhin): there is vpsraq but requires AVX512
             XMMRegister dst = i.OutputSimd128Register();
             XMMRegister src = i.InputSimd128Register(0);
-            if (HasImmediateInput(instr, 1)) {
+            if (CpuFeatures::IsSupported(AVX512)) {
+              CpuFeatureScope avx512_scope(masm(), AVX512);
+              if (HasImmediateInput(instr, 1)) {
+                __ vpsraq(dst, src, uint8_t{i.InputInt6(1)});
+              } else {
+                // Take shift value modulo 2^6.
+                __ movq(kScratchRegister, i.InputRegister(1));
+                __ andq(kScratchRegister, Immediate(63));
+                __ Movq(kScratchDoubleReg, kScratchRegister);
+                __ vpsraq(dst, src, kScratchDoubleReg);
+              }
+            } else if (HasImmediateInput(instr, 1)) {
               __ I64x2ShrS(dst, src, i.InputInt6(1), kScratchDoubleReg);
             } else {
               __ I64x2ShrS(dst, src, i.InputRegister(1), kScratchDoubleReg,
@@ -4808,8 +4818,11 @@ CodeGenerator::CodeGenResult CodeGenerator::AssembleArchInstruction(
             break;
           }
           case kL64: {
-            // I64x2ShrS
-            UNIMPLEMENTED();
+            // I64x4ShrS
+            // Take shift value modulo 2^6.
+            CpuFeatureScope avx512_scope(masm(), AVX512);
+            ASSEMBLE_SIMD256_SHIFT(psraq, 6);
+            break;
           }
           default:
             UNREACHABLE();
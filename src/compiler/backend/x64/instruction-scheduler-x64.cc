@@ -4,6 +4,8 @@
 
 #include "src/compiler/backend/instruction-scheduler.h"
 
+#include <algorithm>
+
 namespace v8 {
 namespace internal {
 namespace compiler {
@@ -507,6 +509,247 @@ int InstructionScheduler::GetInstructionLatency(const Instruction* instr) {
   }
 }
 
+namespace {
+
+// Load-to-use latency of an L1 data cache hit.
+int LoadLatency(SchedulerCpuModel cpu) {
+  return cpu == SchedulerCpuModel::kAmdZen ? 4 : 5;
+}
+
+}  // namespace
+
+int InstructionScheduler::GetTargetInstructionLatency(
+    const Instruction* instr) const {
+  // Register-to-register latencies taken from the Intel and AMD optimization
+  // manuals. Instructions with a memory operand pay the load latency on top.
+  const bool skylake = machine_model_.cpu == SchedulerCpuModel::kIntelSkylake;
+  int latency;
+  switch (instr->arch_opcode()) {
+    case kX64Movb:
+    case kX64Movw:
+    case kX64Movl:
+    case kX64Movq:
+    case kX64Movsd:
+    case kX64Movss:
+    case kX64Movsh:
+    case kX64Movdqu:
+    case kX64Movdqu256:
+    case kX64Movsxbl:
+    case kX64Movsxbq:
+    case kX64Movsxlq:
+    case kX64Movsxwl:
+    case kX64Movsxwq:
+    case kX64Movzxbl:
+    case kX64Movzxbq:
+    case kX64Movzxwl:
+    case kX64Movzxwq:
+    case kX64MovqDecompressTaggedSigned:
+    case kX64MovqDecompressTagged:
+    case kX64MovqDecompressProtected:
+      // Moves only pay for the memory access, if any.
+      latency = 0;
+      break;
+    case kX64Imul:
+    case kX64Imul32:
+      latency = 3;
+      break;
+    case kX64ImulHigh32:
+    case kX64UmulHigh32:
+    case kX64ImulHigh64:
+    case kX64UmulHigh64:
+      latency = skylake ? 4 : 3;
+      break;
+    case kX64Idiv:
+      latency = skylake ? 42 : 45;
+      break;
+    case kX64Udiv:
+      latency = skylake ? 35 : 45;
+      break;
+    case kX64Idiv32:
+    case kX64Udiv32:
+      latency = skylake ? 26 : 30;
+      break;
+    case kX64Float32Abs:
+    case kX64Float32Neg:
+    case kX64Float64Abs:
+    case kX64Float64Neg:
+      latency = 1;
+      break;
+    case kSSEFloat32Add:
+    case kSSEFloat32Sub:
+    case kSSEFloat64Add:
+    case kSSEFloat64Sub:
+    case kAVXFloat32Add:
+    case kAVXFloat32Sub:
+    case kAVXFloat64Add:
+    case kAVXFloat64Sub:
+      latency = skylake ? 4 : 3;
+      break;
+    case kSSEFloat32Mul:
+    case kSSEFloat64Mul:
+    case kAVXFloat32Mul:
+    case kAVXFloat64Mul:
+      latency = skylake ? 4 : 3;
+      break;
+    case kSSEFloat32Cmp:
+    case kSSEFloat64Cmp:
+    case kAVXFloat32Cmp:
+    case kAVXFloat64Cmp:
+      latency = 3;
+      break;
+    case kSSEFloat32Max:
+    case kSSEFloat64Max:
+    case kSSEFloat32Min:
+    case kSSEFloat64Min:
+      latency = skylake ? 4 : 1;
+      break;
+    case kSSEFloat32Div:
+    case kAVXFloat32Div:
+      latency = skylake ? 11 : 10;
+      break;
+    case kSSEFloat64Div:
+    case kAVXFloat64Div:
+      latency = skylake ? 14 : 13;
+      break;
+    case kSSEFloat32Sqrt:
+      latency = skylake ? 12 : 14;
+      break;
+    case kSSEFloat64Sqrt:
+      latency = skylake ? 18 : 20;
+      break;
+    case kSSEFloat32Round:
+    case kSSEFloat64Round:
+      latency = skylake ? 8 : 3;
+      break;
+    case kSSEFloat32ToFloat64:
+    case kSSEFloat64ToFloat32:
+      latency = skylake ? 5 : 3;
+      break;
+    case kSSEFloat32ToInt32:
+    case kSSEFloat32ToUint32:
+    case kSSEFloat64ToInt32:
+    case kSSEFloat64ToUint32:
+      latency = skylake ? 6 : 4;
+      break;
+    case kSSEFloat32ToInt64:
+    case kSSEFloat64ToInt64:
+    case kSSEFloat32ToUint64:
+    case kSSEFloat64ToUint64:
+    case kSSEFloat64ToFloat16:
+      latency = 10;
+      break;
+    case kSSEFloat64Mod:
+      latency = 50;
+      break;
+    case kArchTruncateDoubleToI:
+      latency = 6;
+      break;
+    default:
+      latency = 1;
+      break;
+  }
+  if (IsLoadOperation(instr)) latency += LoadLatency(machine_model_.cpu);
+  return std::max(latency, 1);
+}
+
+SchedulerResource InstructionScheduler::GetTargetInstructionResource(
+    const Instruction* instr) const {
+  switch (instr->arch_opcode()) {
+    case kX64Add:
+    case kX64Add32:
+    case kX64And:
+    case kX64And32:
+    case kX64Cmp:
+    case kX64Cmp32:
+    case kX64Cmp16:
+    case kX64Cmp8:
+    case kX64Test:
+    case kX64Test32:
+    case kX64Test16:
+    case kX64Test8:
+    case kX64Or:
+    case kX64Or32:
+    case kX64Xor:
+    case kX64Xor32:
+    case kX64Sub:
+    case kX64Sub32:
+    case kX64Not:
+    case kX64Not32:
+    case kX64Neg:
+    case kX64Neg32:
+    case kX64Shl:
+    case kX64Shl32:
+    case kX64Shr:
+    case kX64Shr32:
+    case kX64Sar:
+    case kX64Sar32:
+    case kX64Rol:
+    case kX64Rol32:
+    case kX64Ror:
+    case kX64Ror32:
+    case kX64Lea:
+    case kX64Lea32:
+    case kX64Inc32:
+    case kX64Dec32:
+    case kX64Movl:
+    case kX64Movq:
+    case kX64Movsxbl:
+    case kX64Movsxbq:
+    case kX64Movsxlq:
+    case kX64Movsxwl:
+    case kX64Movsxwq:
+    case kX64Movzxbl:
+    case kX64Movzxbq:
+    case kX64Movzxwl:
+    case kX64Movzxwq:
+      return SchedulerResource::kAlu;
+    case kX64Imul:
+    case kX64Imul32:
+    case kX64ImulHigh32:
+    case kX64UmulHigh32:
+    case kX64ImulHigh64:
+    case kX64UmulHigh64:
+      return SchedulerResource::kMul;
+    case kX64Idiv:
+    case kX64Idiv32:
+    case kX64Udiv:
+    case kX64Udiv32:
+      return SchedulerResource::kDiv;
+    case kSSEFloat32Add:
+    case kSSEFloat32Sub:
+    case kSSEFloat64Add:
+    case kSSEFloat64Sub:
+    case kAVXFloat32Add:
+    case kAVXFloat32Sub:
+    case kAVXFloat64Add:
+    case kAVXFloat64Sub:
+    case kSSEFloat32Cmp:
+    case kSSEFloat64Cmp:
+    case kAVXFloat32Cmp:
+    case kAVXFloat64Cmp:
+    case kSSEFloat32Max:
+    case kSSEFloat64Max:
+    case kSSEFloat32Min:
+    case kSSEFloat64Min:
+      return SchedulerResource::kFpAdd;
+    case kSSEFloat32Mul:
+    case kSSEFloat64Mul:
+    case kAVXFloat32Mul:
+    case kAVXFloat64Mul:
+      return SchedulerResource::kFpMul;
+    case kSSEFloat32Div:
+    case kSSEFloat64Div:
+    case kAVXFloat32Div:
+    case kAVXFloat64Div:
+    case kSSEFloat32Sqrt:
+    case kSSEFloat64Sqrt:
+    case kSSEFloat64Mod:
+      return SchedulerResource::kFpDiv;
+    default:
+      return SchedulerResource::kUnconstrained;
+  }
+}
+
 }  // namespace compiler
 }  // namespace internal
 }  // namespace v8
@@ -6070,6 +6070,7 @@ VISIT_ATOMIC_BINOP(Xor)
   V(I16x16Shl, IShl, kL16, kV256)                     \
   V(I32x8ShrS, IShrS, kL32, kV256)                    \
   V(I16x16ShrS, IShrS, kL16, kV256)                   \
+  V(I64x4ShrS, IShrS, kL64, kV256)                    \
   V(I64x4ShrU, IShrU, kL64, kV256)                    \
   V(I32x8ShrU, IShrU, kL32, kV256)                    \
   V(I16x16ShrU, IShrU, kL16, kV256)
@@ -719,6 +719,7 @@ std::ostream& operator<<(std::ostream& os, TruncateKind kind) {
   IF_WASM(V, I8x32Neg, Operator::kNoProperties, 1, 0, 1)                       \
   IF_WASM(V, I8x32Abs, Operator::kNoProperties, 1, 0, 1)                       \
   IF_WASM(V, I64x4Shl, Operator::kNoProperties, 2, 0, 1)                       \
+  IF_WASM(V, I64x4ShrS, Operator::kNoProperties, 2, 0, 1)                      \
   IF_WASM(V, I64x4ShrU, Operator::kNoProperties, 2, 0, 1)                      \
   IF_WASM(V, I32x8Shl, Operator::kNoProperties, 2, 0, 1)                       \
   IF_WASM(V, I32x8ShrS, Operator::kNoProperties, 2, 0, 1)                      \
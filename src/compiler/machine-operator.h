@@ -1166,6 +1166,7 @@ class V8_EXPORT_PRIVATE MachineOperatorBuilder final
   const Operator* I8x32Neg();
   const Operator* I8x32Abs();
   const Operator* I64x4Shl();
+  const Operator* I64x4ShrS();
   const Operator* I64x4ShrU();
   const Operator* I32x8Shl();
   const Operator* I32x8ShrS();
@@ -1248,6 +1248,7 @@
   V(I8x32Abs)                      \
   V(I8x32Neg)                      \
   V(I64x4Shl)                      \
+  V(I64x4ShrS)                     \
   V(I64x4ShrU)                     \
   V(I32x8Shl)                      \
   V(I32x8ShrS)                     \
@@ -4,6 +4,7 @@
 
 #include "src/compiler/pipeline.h"
 
+#include <algorithm>
 #include <fstream>
 #include <iostream>
 #include <memory>
@@ -107,6 +108,7 @@
 #include "src/compiler/value-numbering-reducer.h"
 #include "src/compiler/verifier.h"
 #include "src/compiler/zone-stats.h"
+#include "src/diagnostics/basic-block-profiler.h"
 #include "src/diagnostics/code-tracer.h"
 #include "src/diagnostics/disassembler.h"
 #include "src/flags/flags.h"
@@ -566,6 +568,16 @@ class PipelineCompilationJob final : public TurbofanCompilationJob {
   turboshaft::PipelineData turboshaft_data_;
   PipelineImpl pipeline_;
   Linkage* linkage_;
+  // Whether the Turboshaft graph is built from Maglev rather than from the
+  // Turbofan graph (see --turboshaft-from-maglev-on-tierup).
+  bool use_maglev_frontend_ = false;
+  // State for --turbo-profile-guided-block-layout. The hints are computed on
+  // the main thread from the counters of a previously instrumented version,
+  // and the counters of newly instrumented code are handed to the isolate.
+  bool profile_guided_block_layout_ = false;
+  OptimizedFunctionBlockProfiles::Key block_profile_key_;
+  std::shared_ptr<const BlockProfileHints> block_profile_;
+  std::unique_ptr<BasicBlockProfilerData> block_profiler_data_;
 };
 
 PipelineCompilationJob::PipelineCompilationJob(
@@ -785,6 +797,37 @@ PipelineCompilationJob::Status PipelineCompilationJob::PrepareJobImpl(
 
   if (compilation_info()->is_osr()) data_.InitializeOsrHelper();
 
+  // Functions tiering up from Maglev already went through the Maglev graph
+  // builder with the same feedback, so reuse that frontend rather than
+  // rebuilding and re-optimizing a Turbofan graph from bytecode.
+  use_maglev_frontend_ =
+      v8_flags.turboshaft_from_maglev ||
+      (v8_flags.turboshaft_from_maglev_on_tierup &&
+       compilation_info()->closure()->ActiveTierIsMaglev(isolate));
+  if (V8_UNLIKELY(use_maglev_frontend_ &&
+                  v8_flags.trace_turboshaft_from_maglev)) {
+    CodeTracer::StreamScope tracing_scope(isolate->GetCodeTracer());
+    tracing_scope.stream() << "[building the Turboshaft graph of "
+                           << compilation_info()->GetDebugName().get()
+                           << " from Maglev]" << std::endl;
+  }
+
+  // Block profiles are keyed on the function's position in its script. OSR
+  // code only covers part of the function, so it is neither instrumented nor
+  // laid out from a profile.
+  DirectHandle<SharedFunctionInfo> shared = compilation_info()->shared_info();
+  if (V8_UNLIKELY(v8_flags.turbo_profile_guided_block_layout) &&
+      !compilation_info()->is_osr() && IsScript(shared->script())) {
+    OptimizedFunctionBlockProfiles* profiles =
+        isolate->optimized_function_block_profiles();
+    block_profile_key_ = {Cast<Script>(shared->script())->id(),
+                          shared->StartPosition()};
+    block_profile_ = profiles->GetHints(block_profile_key_);
+    profile_guided_block_layout_ =
+        block_profile_ != nullptr ||
+        profiles->ClaimInstrumentation(block_profile_key_);
+  }
+
   // InitializeHeapBroker() and CreateGraph() may already use
   // IsPendingAllocation.
   isolate->heap()->PublishMainThreadPendingAllocations();
@@ -809,7 +852,7 @@ PipelineCompilationJob::Status PipelineCompilationJob::ExecuteJobImpl(
                                                    data_.dependencies());
   turboshaft::Pipeline turboshaft_pipeline(&turboshaft_data_);
 
-  if (V8_UNLIKELY(v8_flags.turboshaft_from_maglev)) {
+  if (V8_UNLIKELY(use_maglev_frontend_)) {
     if (!turboshaft_pipeline.CreateGraphWithMaglev()) {
       return AbortOptimization(BailoutReason::kGraphBuildingFailed);
     }
@@ -832,6 +875,11 @@ PipelineCompilationJob::Status PipelineCompilationJob::ExecuteJobImpl(
     return FAILED;
   }
 
+  if (V8_UNLIKELY(profile_guided_block_layout_)) {
+    block_profiler_data_ =
+        turboshaft_pipeline.ProfileGuidedBlockLayout(block_profile_.get());
+  }
+
 #ifdef TARGET_SUPPORTS_TURBOSHAFT_INSTRUCTION_SELECTION
   bool use_turboshaft_instruction_selection =
       v8_flags.turboshaft_instruction_selection;
@@ -897,6 +945,11 @@ PipelineCompilationJob::Status PipelineCompilationJob::FinalizeJobImpl(
 #ifdef TARGET_SUPPORTS_TURBOSHAFT_INSTRUCTION_SELECTION
   }
 #endif
+  if (V8_UNLIKELY(block_profiler_data_ != nullptr)) {
+    isolate->optimized_function_block_profiles()->Register(
+        block_profile_key_, std::move(block_profiler_data_),
+        compilation_info()->closure(), code);
+  }
   compilation_info()->SetCode(code);
   GlobalHandleVector<Map> maps = CollectRetainedMaps(isolate, code);
   RegisterWeakObjectsInOptimizedCode(isolate, context, code, std::move(maps));
@@ -3450,6 +3503,7 @@ void Pipeline::GenerateCodeForWasmFunction(
   result->protected_instructions_data =
       code_generator->GetProtectedInstructionsData();
   result->result_tier = wasm::ExecutionTier::kTurbofan;
+  result->max_zone_size = zone_stats.GetMaxAllocatedBytes();
 
   if (data.info()->trace_turbo_json()) {
     TurboJsonFile json_of(data.info(), std::ios_base::app);
@@ -3555,12 +3609,16 @@ bool Pipeline::GenerateWasmCodeFromTurboshaftGraph(
   // from the beginning.
   turboshaft_data.InitializeGraphComponent(data.source_positions());
 
-  AccountingAllocator allocator;
-  wasm::BuildTSGraph(&turboshaft_data, &allocator, env, detected,
-                     turboshaft_data.graph(), compilation_data.func_body,
-                     compilation_data.wire_bytes_storage,
-                     compilation_data.assumptions, &inlining_positions,
-                     compilation_data.func_index);
+  {
+    // The decoder's zone is only needed while building the graph.
+    ZoneStats::Scope graph_building_scope(&zone_stats, ZONE_NAME);
+    wasm::BuildTSGraph(&turboshaft_data, graph_building_scope.zone(), env,
+                       detected, turboshaft_data.graph(),
+                       compilation_data.func_body,
+                       compilation_data.wire_bytes_storage,
+                       compilation_data.assumptions, &inlining_positions,
+                       compilation_data.func_index);
+  }
   CodeTracer* code_tracer = nullptr;
   if (turboshaft_data.info()->trace_turbo_graph()) {
     // NOTE: We must not call `GetCodeTracer` if tracing is not enabled,
@@ -3568,7 +3626,7 @@ bool Pipeline::GenerateWasmCodeFromTurboshaftGraph(
     // background thread is not threadsafe.
     code_tracer = data.GetCodeTracer();
   }
-  Zone printing_zone(&allocator, ZONE_NAME);
+  Zone printing_zone(wasm_engine->allocator(), ZONE_NAME);
   turboshaft::PrintTurboshaftGraph(&turboshaft_data, &printing_zone,
                                    code_tracer, "Graph generation");
 
@@ -3600,7 +3658,16 @@ bool Pipeline::GenerateWasmCodeFromTurboshaftGraph(
       detected->has_gc() || detected->has_typed_funcref() ||
       detected->has_stringref() || detected->has_imported_strings() ||
       detected->has_imported_strings_utf8();
-  if (v8_flags.wasm_loop_peeling && uses_wasm_gc_features) {
+  // Memory64 accesses with the same index share their bounds check, so
+  // peeling makes the checks of loop-invariant indices in the loop body
+  // redundant.
+  const bool uses_memory64 =
+      std::any_of(module->memories.begin(), module->memories.end(),
+                  [](const wasm::WasmMemory& memory) {
+                    return memory.is_memory64() &&
+                           memory.bounds_checks == wasm::kTrapHandler;
+                  });
+  if (v8_flags.wasm_loop_peeling && (uses_wasm_gc_features || uses_memory64)) {
     turboshaft_pipeline.Run<turboshaft::LoopPeelingPhase>();
   }
 
@@ -3673,6 +3740,9 @@ bool Pipeline::GenerateWasmCodeFromTurboshaftGraph(
       code_generator->GetProtectedInstructionsData();
   result->deopt_data = code_generator->GenerateWasmDeoptimizationData();
   result->result_tier = wasm::ExecutionTier::kTurbofan;
+  // The graph building, Turboshaft and TurboFan pipeline data all take their
+  // zones from {zone_stats}.
+  result->max_zone_size = zone_stats.GetMaxAllocatedBytes();
 
   if (data.info()->trace_turbo_json()) {
     TurboJsonFile json_of(data.info(), std::ios_base::app);
@@ -8625,6 +8625,7 @@ std::ostream& operator<<(std::ostream& os, Simd256BinopOp::Kind kind);
   V(I32x8ShrS)                           \
   V(I32x8ShrU)                           \
   V(I64x4Shl)                            \
+  V(I64x4ShrS)                           \
   V(I64x4ShrU)
 
 struct Simd256ShiftOp : FixedArityOperationT<2, Simd256ShiftOp> {
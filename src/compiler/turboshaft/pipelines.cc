@@ -55,6 +55,60 @@ MaybeHandle<Code> Pipeline::GenerateCode(
   return FinalizeCode();
 }
 
+namespace {
+
+// Hash the block structure and opcodes of the graph, so that a block profile
+// is only applied to the graph it was collected on. The result value is in the
+// valid Smi range.
+int HashGraphForBlockProfile(const Graph& graph) {
+  size_t hash = graph.block_count();
+  for (const Block& block : graph.blocks()) {
+    hash = base::hash_combine(hash, block.index().id(),
+                              block.PredecessorCount());
+    for (const Operation& op : graph.operations(block)) {
+      hash = base::hash_combine(hash, op.opcode);
+    }
+  }
+  return Tagged<Smi>(IntToSmi(static_cast<int>(hash))).value();
+}
+
+}  // namespace
+
+std::unique_ptr<BasicBlockProfilerData> Pipeline::ProfileGuidedBlockLayout(
+    const ProfileDataFromFile* profile) {
+  DCHECK_EQ(data()->pipeline_kind(), TurboshaftPipelineKind::kJS);
+  const int hash = HashGraphForBlockProfile(data()->graph());
+  const bool trace = v8_flags.trace_turbo_profile_guided_block_layout;
+  if (profile != nullptr) {
+    // The feedback may have changed since the profile was taken, in which
+    // case the block ids no longer match up. The function is not instrumented
+    // again, so that it cannot keep cycling through instrumented code.
+    if (profile->hash() != hash) {
+      if (V8_UNLIKELY(trace)) {
+        PrintF("[block profile: %s changed since it was profiled]\n",
+               info()->GetDebugName().get());
+      }
+      return {};
+    }
+    if (V8_UNLIKELY(trace)) {
+      PrintF("[block profile: laying out %s]\n", info()->GetDebugName().get());
+    }
+    Run<ProfileApplicationPhase>(profile);
+    return {};
+  }
+
+  if (V8_UNLIKELY(trace)) {
+    PrintF("[block profile: instrumenting %s]\n", info()->GetDebugName().get());
+  }
+  auto profiler_data =
+      std::make_unique<BasicBlockProfilerData>(data()->graph().block_count());
+  profiler_data->SetFunctionName(info()->GetDebugName());
+  profiler_data->SetHash(hash);
+  info()->set_profiler_data(profiler_data.get());
+  Run<BlockInstrumentationPhase>();
+  return profiler_data;
+}
+
 void BuiltinPipeline::OptimizeBuiltin() {
   Tracing::Scope tracing_scope(data()->info());
 
@@ -517,6 +517,14 @@ class Pipeline {
       JumpOptimizationInfo* jump_optimization_info = nullptr,
       const ProfileDataFromFile* profile = nullptr, int initial_graph_hash = 0);
 
+  // Profile-guided block layout of JS functions (see
+  // --turbo-profile-guided-block-layout): applies the branch hints of
+  // {profile} if it was collected on an identical graph. Without a {profile},
+  // instruments the graph and returns the block counters, which the caller
+  // must keep alive for as long as the generated code can run.
+  std::unique_ptr<BasicBlockProfilerData> ProfileGuidedBlockLayout(
+      const ProfileDataFromFile* profile);
+
   void RecreateTurbofanGraph(compiler::TFPipelineData* turbofan_data,
                              Linkage* linkage);
 
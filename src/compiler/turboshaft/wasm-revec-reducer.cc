@@ -7,6 +7,7 @@
 #include <optional>
 
 #include "src/base/logging.h"
+#include "src/codegen/cpu-features.h"
 #include "src/compiler/turboshaft/opmasks.h"
 #include "src/wasm/simd-shuffle.h"
 
@@ -770,6 +771,18 @@ PackNode* SLPTree::BuildTreeRec(const NodeGroup& node_group,
       Simd128ShiftOp& shift_op0 = op0.Cast<Simd128ShiftOp>();
       Simd128ShiftOp& shift_op1 = op1.Cast<Simd128ShiftOp>();
       if (IsEqual(shift_op0.shift(), shift_op1.shift())) {
+        // There is no arithmetic right shift of 64-bit lanes before AVX-512.
+#ifdef V8_TARGET_ARCH_X64
+        const bool has_i64x4_shr_s = CpuFeatures::IsSupported(AVX512);
+#else
+        const bool has_i64x4_shr_s = false;
+#endif  // V8_TARGET_ARCH_X64
+        if (shift_op0.kind == Simd128ShiftOp::Kind::kI64x2ShrS &&
+            !has_i64x4_shr_s) {
+          TRACE("Unsupported Simd128ShiftOp: %s\n",
+                GetSimdOpcodeName(op0).c_str());
+          return nullptr;
+        }
         switch (op0.Cast<Simd128ShiftOp>().kind) {
 #define SHIFT_CASE(op_128, not_used) case Simd128ShiftOp::Kind::k##op_128:
           SIMD256_SHIFT_OP(SHIFT_CASE) {
@@ -176,6 +176,7 @@ namespace v8::internal::compiler::turboshaft {
   V(I32x4ShrS, I32x8ShrS)   \
   V(I32x4ShrU, I32x8ShrU)   \
   V(I64x2Shl, I64x4Shl)     \
+  V(I64x2ShrS, I64x4ShrS)   \
   V(I64x2ShrU, I64x4ShrU)
 
 #define SIMD256_TERNARY_OP(V)                        \
@@ -3671,11 +3671,12 @@ std::pair<Node*, BoundsCheckResult> WasmGraphBuilder::BoundsCheckMem(
   if (bounds_checks == wasm::kTrapHandler &&
       enforce_check == EnforceBoundsCheck::kCanOmitBoundsCheck) {
     if (memory->is_memory64()) {
-      // Bounds check `index` against `max_mem_size - end_offset`, such that
-      // at runtime `index + end_offset` will be within `max_mem_size`, where
-      // the trap handler can handle out-of-bound accesses.
+      // Bounds check `index` such that at runtime `index + end_offset` will
+      // be within the reserved memory region, where the trap handler can
+      // handle out-of-bound accesses.
       Node* cond = gasm_->Uint64LessThan(
-          converted_index, Int64Constant(memory->max_memory_size - end_offset));
+          converted_index,
+          Int64Constant(memory->trap_handler_index_limit(end_offset)));
       TrapIfFalse(wasm::kTrapMemOutOfBounds, cond, position);
     }
     return {converted_index, BoundsCheckResult::kTrapHandler};
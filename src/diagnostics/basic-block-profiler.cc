@@ -7,10 +7,15 @@
 #include <algorithm>
 #include <numeric>
 #include <sstream>
+#include <unordered_map>
 
 #include "src/base/lazy-instance.h"
 #include "src/builtins/profile-data-reader.h"
+#include "src/deoptimizer/deoptimizer.h"
+#include "src/handles/global-handles.h"
 #include "src/heap/heap-inl.h"
+#include "src/objects/code-inl.h"
+#include "src/objects/js-function-inl.h"
 #include "src/objects/shared-function-info-inl.h"
 
 namespace v8 {
@@ -275,6 +280,132 @@ std::ostream& operator<<(std::ostream& os, const BasicBlockProfilerData& d) {
   return os;
 }
 
+BlockProfileHints::BlockProfileHints(const BasicBlockProfilerData& data) {
+  hash_ = data.hash();
+  std::unordered_map<int32_t, uint32_t> count_by_id;
+  for (size_t i = 0; i < data.n_blocks(); ++i) {
+    count_by_id[data.block_ids()[i]] = data.counts()[i];
+  }
+  for (const auto& [true_id, false_id] : data.branches()) {
+    auto true_it = count_by_id.find(true_id);
+    auto false_it = count_by_id.find(false_id);
+    if (true_it == count_by_id.end() || false_it == count_by_id.end()) continue;
+    const uint64_t true_count = true_it->second;
+    const uint64_t false_count = false_it->second;
+    if (true_count + false_count < kMinBranchCount) continue;
+    if (true_count >= false_count * kHotToColdRatio) {
+      block_hints_by_id.emplace(std::make_pair(true_id, false_id), true);
+    } else if (false_count >= true_count * kHotToColdRatio) {
+      block_hints_by_id.emplace(std::make_pair(true_id, false_id), false);
+    }
+  }
+}
+
+OptimizedFunctionBlockProfiles::OptimizedFunctionBlockProfiles(
+    Isolate* isolate)
+    : isolate_(isolate) {}
+
+OptimizedFunctionBlockProfiles::~OptimizedFunctionBlockProfiles() = default;
+
+OptimizedFunctionBlockProfiles::Entry::~Entry() {
+  if (function != nullptr) GlobalHandles::Destroy(function);
+  if (code != nullptr) GlobalHandles::Destroy(code);
+}
+
+void OptimizedFunctionBlockProfiles::Register(
+    Key key, std::unique_ptr<BasicBlockProfilerData> data,
+    DirectHandle<JSFunction> function, DirectHandle<Code> code) {
+  DCHECK_GT(data->n_blocks(), 0);
+  DCHECK(instrumented_.contains(key));
+  DCHECK(!profiles_.contains(key));
+  FreeRetiredProfiles();
+  auto entry = std::make_unique<Entry>();
+  entry->data = std::move(data);
+  entry->function = isolate_->global_handles()->Create(*function).location();
+  GlobalHandles::MakeWeak(&entry->function);
+  entry->code = isolate_->global_handles()->Create(*code).location();
+  GlobalHandles::MakeWeak(&entry->code);
+  profiles_[key] = std::move(entry);
+}
+
+std::shared_ptr<const BlockProfileHints>
+OptimizedFunctionBlockProfiles::GetHints(Key key) {
+  if (auto it = hints_.find(key); it != hints_.end()) return it->second;
+  // The function may be optimized again before the profile was found to be
+  // complete on an interrupt tick.
+  auto it = profiles_.find(key);
+  if (it == profiles_.end() || !it->second->IsComplete()) return {};
+  return Complete(it);
+}
+
+std::shared_ptr<const BlockProfileHints>
+OptimizedFunctionBlockProfiles::Complete(EntryMap::iterator it) {
+  DCHECK(it->second->IsComplete());
+  auto hints = std::make_shared<const BlockProfileHints>(*it->second->data);
+  hints_[it->first] = hints;
+  Retire(std::move(it->second));
+  profiles_.erase(it);
+  return hints;
+}
+
+void OptimizedFunctionBlockProfiles::Retire(std::unique_ptr<Entry> entry) {
+  if (entry->code != nullptr) retired_.push_back(std::move(entry));
+}
+
+void OptimizedFunctionBlockProfiles::FreeRetiredProfiles() {
+  std::erase_if(retired_, [](const std::unique_ptr<Entry>& entry) {
+    return entry->code == nullptr;
+  });
+}
+
+void OptimizedFunctionBlockProfiles::ReoptimizeProfiledFunctions() {
+  FreeRetiredProfiles();
+  for (auto it = profiles_.begin(); it != profiles_.end();) {
+    Entry* entry = it->second.get();
+    if (entry->IsComplete()) {
+      if (V8_UNLIKELY(v8_flags.trace_turbo_profile_guided_block_layout)) {
+        PrintF("[block profile: profile of %s is complete]\n",
+               entry->data->function_name().c_str());
+      }
+      DeoptimizeInstrumentedCode(entry);
+      if (entry->function != nullptr) {
+        Tagged<JSFunction> function =
+            Cast<JSFunction>(Tagged<Object>(*entry->function));
+        if (function->has_feedback_vector() &&
+            !function->ActiveTierIsTurbofan(isolate_) &&
+            !function->shared()->optimization_disabled()) {
+          function->MarkForOptimization(isolate_, CodeKind::TURBOFAN_JS,
+                                        ConcurrencyMode::kConcurrent);
+        }
+      }
+      Complete(it++);
+    } else if (entry->code == nullptr ||
+               Cast<Code>(Tagged<Object>(*entry->code))
+                   ->marked_for_deoptimization()) {
+      // The code stopped collecting counts before the profile was complete.
+      // The function is not instrumented again.
+      Retire(std::move(it->second));
+      it = profiles_.erase(it);
+    } else {
+      ++it;
+    }
+  }
+}
+
+void OptimizedFunctionBlockProfiles::DeoptimizeInstrumentedCode(Entry* entry) {
+  // Once the code is dead, nothing can update the counters anymore.
+  if (entry->code == nullptr) return;
+  Tagged<Code> code = Cast<Code>(Tagged<Object>(*entry->code));
+  if (code->marked_for_deoptimization()) return;
+  if (entry->function != nullptr) {
+    Deoptimizer::DeoptimizeFunction(
+        Cast<JSFunction>(Tagged<Object>(*entry->function)), code);
+  } else {
+    code->set_marked_for_deoptimization(true);
+    Deoptimizer::DeoptimizeMarkedCode(isolate_);
+  }
+}
+
 BuiltinsCallGraph::BuiltinsCallGraph() : all_hash_matched_(true) {}
 
 void BuiltinsCallGraph::AddBuiltinCall(Builtin caller, Builtin callee,
@@ -7,18 +7,23 @@
 
 #include <iosfwd>
 #include <list>
+#include <map>
 #include <memory>
+#include <set>
 #include <string>
 #include <vector>
 
 #include "src/base/macros.h"
 #include "src/base/platform/mutex.h"
+#include "src/builtins/profile-data-reader.h"
 #include "src/common/globals.h"
 #include "src/objects/shared-function-info.h"
 
 namespace v8 {
 namespace internal {
 
+class Code;
+class JSFunction;
 class OnHeapBasicBlockProfilerData;
 
 class BasicBlockProfilerData {
@@ -38,6 +43,12 @@ class BasicBlockProfilerData {
     return block_ids_.size();
   }
   const uint32_t* counts() const { return &counts_[0]; }
+  const std::vector<int32_t>& block_ids() const { return block_ids_; }
+  const std::vector<std::pair<int32_t, int32_t>>& branches() const {
+    return branches_;
+  }
+  int hash() const { return hash_; }
+  const std::string& function_name() const { return function_name_; }
 
   void SetCode(const std::ostringstream& os);
   void SetFunctionName(std::unique_ptr<char[]> name);
@@ -102,6 +113,107 @@ class BasicBlockProfiler {
 
 std::ostream& operator<<(std::ostream& os, const BasicBlockProfilerData& s);
 
+// Branch hints derived from the counters of an instrumented optimized function,
+// in the same form as the builtins profiles read from disk. A branch is hinted
+// once it has been taken often enough and one of its successors clearly
+// dominates the other.
+class BlockProfileHints : public ProfileDataFromFile {
+ public:
+  static constexpr uint32_t kMinBranchCount = 100;
+  static constexpr uint32_t kHotToColdRatio = 10;
+
+  // Must be called on the main thread, since the counters are updated by the
+  // running code.
+  explicit BlockProfileHints(const BasicBlockProfilerData& data);
+};
+
+// Block counters of optimized JavaScript functions instrumented for
+// --turbo-profile-guided-block-layout, owned by the isolate. Profiles are keyed
+// by script id and function start position, so that they outlive the
+// instrumented code and can be applied when the function is optimized again.
+// Each function is instrumented at most once; the hints computed from its
+// complete profile are kept and applied to all its later optimized versions.
+// All methods must be called on the main thread.
+class OptimizedFunctionBlockProfiles {
+ public:
+  using Key = std::pair<int, int>;
+
+  // Number of calls of the instrumented code after which its profile is
+  // considered complete and the function is re-optimized.
+  static constexpr uint32_t kMinInvocationCount = 1000;
+  // Number of interrupt ticks between two checks for complete profiles.
+  static constexpr int kTicksPerCheck = 16;
+
+  explicit OptimizedFunctionBlockProfiles(Isolate* isolate);
+  ~OptimizedFunctionBlockProfiles();
+  OptimizedFunctionBlockProfiles(const OptimizedFunctionBlockProfiles&) =
+      delete;
+  OptimizedFunctionBlockProfiles& operator=(
+      const OptimizedFunctionBlockProfiles&) = delete;
+
+  // Returns true the first time it is called for {key}, in which case the
+  // caller instruments the function and registers the counters.
+  bool ClaimInstrumentation(Key key) {
+    return instrumented_.insert(key).second;
+  }
+
+  // Takes ownership of {data}, whose counters are updated by {code}, the
+  // instrumented code of {function}.
+  void Register(Key key, std::unique_ptr<BasicBlockProfilerData> data,
+                DirectHandle<JSFunction> function, DirectHandle<Code> code);
+
+  // Returns the branch hints for {key} once its profile is complete, or
+  // nullptr. Never deoptimizes code, so it may be called while preparing a
+  // compilation job.
+  std::shared_ptr<const BlockProfileHints> GetHints(Key key);
+
+  // Instrumented Turbofan code takes no interrupt ticks itself, so this is
+  // called on the ticks of other code. Every kTicksPerCheck ticks, it
+  // deoptimizes instrumented code whose profile is complete and marks its
+  // function for optimization, so that the profile gets applied.
+  void OnInterruptTick() {
+    if (profiles_.empty() || --ticks_until_check_ > 0) return;
+    ticks_until_check_ = kTicksPerCheck;
+    ReoptimizeProfiledFunctions();
+  }
+
+ private:
+  struct Entry {
+    ~Entry();
+
+    bool IsComplete() const {
+      // The first counter belongs to the start block, i.e. counts calls.
+      return data->counts()[0] >= kMinInvocationCount;
+    }
+
+    std::unique_ptr<BasicBlockProfilerData> data;
+    // Weak global handles, reset to nullptr when the object dies.
+    Address* function = nullptr;
+    Address* code = nullptr;
+  };
+  using EntryMap = std::map<Key, std::unique_ptr<Entry>>;
+
+  // Computes the hints of the complete profile at {it} and retires the entry.
+  std::shared_ptr<const BlockProfileHints> Complete(EntryMap::iterator it);
+  void ReoptimizeProfiledFunctions();
+  void DeoptimizeInstrumentedCode(Entry* entry);
+  // Keeps the counters of {entry} alive while its code may still run.
+  void Retire(std::unique_ptr<Entry> entry);
+  // Frees the counters of retired entries whose code has been collected.
+  void FreeRetiredProfiles();
+
+  Isolate* const isolate_;
+  // Profiles of instrumented code that is still collecting counts.
+  EntryMap profiles_;
+  std::map<Key, std::shared_ptr<const BlockProfileHints>> hints_;
+  // Functions that have been instrumented, see {ClaimInstrumentation}.
+  std::set<Key> instrumented_;
+  // Entries whose code may still be on the stack, since lazily deoptimized
+  // activations keep running until they return.
+  std::vector<std::unique_ptr<Entry>> retired_;
+  int ticks_until_check_ = kTicksPerCheck;
+};
+
 // This struct comprises all callee inside a block.
 using BlockCallees = std::set<Builtin>;
 // This struct describes a call inside a caller, the key is block id, the value
@@ -134,6 +134,7 @@ enum Prefixes {
   SEGMENT_FS_OVERRIDE_PREFIX = 0x64,
   OPERAND_SIZE_OVERRIDE_PREFIX = 0x66,
   ADDRESS_SIZE_OVERRIDE_PREFIX = 0x67,
+  EVEX_PREFIX = 0x62,
   VEX3_PREFIX = 0xC4,
   VEX2_PREFIX = 0xC5,
   LOCK_PREFIX = 0xF0,
@@ -304,6 +305,10 @@ class DisassemblerX64 {
         vex_byte0_(0),
         vex_byte1_(0),
         vex_byte2_(0),
+        evex_byte0_(0),
+        evex_byte1_(0),
+        evex_byte2_(0),
+        evex_byte3_(0),
         byte_size_operand_(false),
         instruction_table_(GetInstructionTable()) {
     tmp_buffer_[0] = '\0';
@@ -334,6 +339,10 @@ class DisassemblerX64 {
   uint8_t vex_byte0_;            // 0xC4 or 0xC5.
   uint8_t vex_byte1_;
   uint8_t vex_byte2_;  // only for 3 bytes vex prefix.
+  uint8_t evex_byte0_;  // 0x62.
+  uint8_t evex_byte1_;
+  uint8_t evex_byte2_;
+  uint8_t evex_byte3_;
   // Byte size operand override.
   bool byte_size_operand_;
   const InstructionTable* const instruction_table_;
@@ -418,6 +427,31 @@ class DisassemblerX64 {
     return ~(checked >> 3) & 0xF;
   }
 
+  bool evex_w() {
+    DCHECK_EQ(evex_byte0_, EVEX_PREFIX);
+    return (evex_byte2_ & 0x80) != 0;
+  }
+
+  bool evex_256() const {
+    DCHECK_EQ(evex_byte0_, EVEX_PREFIX);
+    return (evex_byte3_ & 0x60) == 0x20;
+  }
+
+  bool evex_66() {
+    DCHECK_EQ(evex_byte0_, EVEX_PREFIX);
+    return (evex_byte2_ & 3) == 1;
+  }
+
+  bool evex_0f() {
+    DCHECK_EQ(evex_byte0_, EVEX_PREFIX);
+    return (evex_byte1_ & 3) == 1;
+  }
+
+  int evex_vreg() {
+    DCHECK_EQ(evex_byte0_, EVEX_PREFIX);
+    return ~(evex_byte2_ >> 3) & 0xF;
+  }
+
   OperandSize operand_size() {
     if (byte_size_operand_) return OPERAND_BYTE_SIZE;
     if (rex_w()) return OPERAND_QUADWORD_SIZE;
@@ -442,7 +476,7 @@ class DisassemblerX64 {
   }
 
   const char* NameOfAVXRegister(int reg) const {
-    if (vex_256()) {
+    if (evex_byte0_ == EVEX_PREFIX ? evex_256() : vex_256()) {
       return NameOfYMMRegister(reg);
     } else {
       return converter_.NameOfXMMRegister(reg);
@@ -490,6 +524,7 @@ class DisassemblerX64 {
   int MemoryFPUInstruction(int escape_opcode, int regop, uint8_t* modrm_start);
   int RegisterFPUInstruction(int escape_opcode, uint8_t modrm_byte);
   int AVXInstruction(uint8_t* data);
+  int EVEXInstruction(uint8_t* data);
   PRINTF_FORMAT(2, 3) void AppendToBuffer(const char* format, ...);
 
   void UnimplementedInstruction() {
@@ -1613,6 +1648,39 @@ int DisassemblerX64::AVXInstruction(uint8_t* data) {
   return static_cast<int>(current - data);
 }
 
+// Only the AVX-512 instructions emitted by the assembler are supported, i.e.
+// 128- and 256-bit register forms without masking or broadcast.
+int DisassemblerX64::EVEXInstruction(uint8_t* data) {
+  uint8_t opcode = *data;
+  uint8_t* current = data + 1;
+  if (evex_66() && evex_0f() && evex_w()) {
+    int mod, regop, rm, vvvv = evex_vreg();
+    get_modrm(*current, &mod, &regop, &rm);
+    switch (opcode) {
+      case 0x72:
+        if (regop == 4) {
+          AppendToBuffer("vpsraq %s,", NameOfAVXRegister(vvvv));
+          current += PrintRightAVXOperand(current);
+          AppendToBuffer(",%u", *current++);
+        } else {
+          UnimplementedInstruction();
+        }
+        break;
+      case 0xE2:
+        AppendToBuffer("vpsraq %s,%s,", NameOfAVXRegister(regop),
+                       NameOfAVXRegister(vvvv));
+        current += PrintRightXMMOperand(current);
+        break;
+      default:
+        UnimplementedInstruction();
+    }
+  } else {
+    UnimplementedInstruction();
+  }
+
+  return static_cast<int>(current - data);
+}
+
 // Returns number of bytes used, including *data.
 int DisassemblerX64::FPUInstruction(uint8_t* data) {
   uint8_t escape_opcode = *data;
@@ -2407,6 +2475,14 @@ int DisassemblerX64::InstructionDecode(v8::base::Vector<char> out_buffer,
       setRex(0x40 | (~(vex_byte1_ >> 5) & 4));
       data += 2;
       break;  // Vex is the last prefix.
+    } else if (current == EVEX_PREFIX) {
+      evex_byte0_ = current;
+      evex_byte1_ = *(data + 1);
+      evex_byte2_ = *(data + 2);
+      evex_byte3_ = *(data + 3);
+      setRex(0x40 | (~(evex_byte1_ >> 5) & 7) | ((evex_byte2_ >> 4) & 8));
+      data += 4;
+      break;  // Evex is the last prefix.
     } else if (current == SEGMENT_FS_OVERRIDE_PREFIX) {
       segment_prefix_ = current;
     } else if (current == ADDRESS_SIZE_OVERRIDE_PREFIX) {
@@ -2421,6 +2497,9 @@ int DisassemblerX64::InstructionDecode(v8::base::Vector<char> out_buffer,
   if (vex_byte0_ != 0) {
     processed = true;
     data += AVXInstruction(data);
+  } else if (evex_byte0_ != 0) {
+    processed = true;
+    data += EVEXInstruction(data);
   } else if (segment_prefix_ != 0 && address_size_prefix_ != 0) {
     if (*data == 0x90 && *(data + 1) == 0x90 && *(data + 2) == 0x90) {
       AppendToBuffer("sscmark");
@@ -4381,6 +4381,9 @@ void Isolate::Deinit() {
     lazy_compile_dispatcher_.reset();
   }
 
+  // Releases global handles, so must happen before they are torn down.
+  optimized_function_block_profiles_.reset();
+
   // At this point there are no more background threads left in this isolate.
   heap_.safepoint()->AssertMainThreadIsOnlyThread();
 
@@ -5876,6 +5879,14 @@ std::unique_ptr<PersistentHandles> Isolate::NewPersistentHandles() {
   return std::make_unique<PersistentHandles>(this);
 }
 
+OptimizedFunctionBlockProfiles* Isolate::optimized_function_block_profiles() {
+  if (!optimized_function_block_profiles_) {
+    optimized_function_block_profiles_ =
+        std::make_unique<OptimizedFunctionBlockProfiles>(this);
+  }
+  return optimized_function_block_profiles_.get();
+}
+
 void Isolate::DumpAndResetStats() {
   if (v8_flags.trace_turbo_stack_accesses) {
     StdoutStream os;
@@ -138,6 +138,7 @@ class V8FileLogger;
 class MaterializedObjectStore;
 class Microtask;
 class MicrotaskQueue;
+class OptimizedFunctionBlockProfiles;
 class OptimizingCompileDispatcher;
 class PersistentHandles;
 class PersistentHandlesList;
@@ -1653,6 +1654,10 @@ class V8_EXPORT_PRIVATE Isolate final : private HiddenFactory {
   }
 #endif  // V8_ENABLE_MAGLEV
 
+  // Block profiles of functions instrumented for
+  // --turbo-profile-guided-block-layout. Created on first use.
+  OptimizedFunctionBlockProfiles* optimized_function_block_profiles();
+
   bool concurrent_recompilation_enabled() {
     // Thread is only available with flag enabled.
     DCHECK(optimizing_compile_dispatcher_ == nullptr ||
@@ -2588,6 +2593,8 @@ class V8_EXPORT_PRIVATE Isolate final : private HiddenFactory {
   Zone* compiler_zone_ = nullptr;
 
   std::unique_ptr<LazyCompileDispatcher> lazy_compile_dispatcher_;
+  std::unique_ptr<OptimizedFunctionBlockProfiles>
+      optimized_function_block_profiles_;
 #ifdef V8_ENABLE_SPARKPLUG
   baseline::BaselineBatchCompiler* baseline_batch_compiler_ = nullptr;
 #endif  // V8_ENABLE_SPARKPLUG
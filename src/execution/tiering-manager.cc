@@ -13,6 +13,7 @@
 #include "src/codegen/compiler.h"
 #include "src/codegen/pending-optimization-table.h"
 #include "src/common/globals.h"
+#include "src/diagnostics/basic-block-profiler.h"
 #include "src/diagnostics/code-tracer.h"
 #include "src/execution/execution.h"
 #include "src/execution/frames-inl.h"
@@ -619,6 +620,10 @@ void TieringManager::OnInterruptTick(DirectHandle<JSFunction> function,
 
   // --- We've decided to proceed for now. ---
 
+  if (V8_UNLIKELY(v8_flags.turbo_profile_guided_block_layout)) {
+    isolate_->optimized_function_block_profiles()->OnInterruptTick();
+  }
+
   DisallowGarbageCollection no_gc;
   OnInterruptTickScope scope;
   Tagged<JSFunction> function_obj = *function;
@@ -587,6 +587,18 @@ DEFINE_INT(max_maglev_inlined_bytecode_size_small, 27,
            "maximum size of bytecode considered for small function inlining")
 DEFINE_FLOAT(min_maglev_inlining_frequency, 0.10,
              "minimum frequency for inlining")
+DEFINE_BOOL(maglev_polymorphic_inlining, false,
+            "dispatch calls whose target is one of a few known functions to "
+            "each target directly, so that every arm can be inlined")
+DEFINE_WEAK_IMPLICATION(maglev_future, maglev_polymorphic_inlining)
+DEFINE_INT(max_maglev_polymorphic_inlining_targets, 4,
+           "maximum number of targets of a polymorphic call site in Maglev")
+DEFINE_INT(max_maglev_polymorphic_inlined_bytecode_size, 460,
+           "maximum cumulative bytecode size of all targets of a polymorphic "
+           "call site in Maglev")
+DEFINE_BOOL(trace_maglev_polymorphic_inlining, false,
+            "trace how many targets of each polymorphic call site Maglev "
+            "inlined")
 DEFINE_WEAK_VALUE_IMPLICATION(turbofan, max_maglev_inline_depth, 1)
 DEFINE_WEAK_VALUE_IMPLICATION(turbofan, max_maglev_inlined_bytecode_size, 100)
 DEFINE_WEAK_VALUE_IMPLICATION(turbofan,
@@ -594,6 +606,16 @@ DEFINE_WEAK_VALUE_IMPLICATION(turbofan,
 DEFINE_WEAK_VALUE_IMPLICATION(turbofan, min_maglev_inlining_frequency, 0.95)
 DEFINE_BOOL(maglev_reuse_stack_slots, true,
             "reuse stack slots in the maglev optimizing compiler")
+DEFINE_BOOL(maglev_cost_aware_register_eviction, false,
+            "when freeing a register in the maglev register allocator, prefer "
+            "values that can be dropped without a spill store")
+DEFINE_BOOL(maglev_loop_aware_regalloc, false,
+            "in the maglev register allocator, split the live ranges of values "
+            "at loop entry so that values used across the loop back-edge "
+            "can stay in registers")
+DEFINE_INT(maglev_loop_aware_regalloc_max_size, 2000,
+           "maximum number of nodes of a function for which "
+           "--maglev-loop-aware-regalloc is used")
 DEFINE_BOOL(maglev_untagged_phis, true,
             "enable phi untagging in the maglev optimizing compiler")
 DEFINE_BOOL(maglev_hoist_osr_value_phi_untagging, true,
@@ -645,6 +667,8 @@ DEFINE_BOOL_READONLY(trace_maglev_regalloc, false,
 DEFINE_BOOL(maglev_stats, false, "print Maglev statistics")
 DEFINE_BOOL(maglev_stats_nvp, false,
             "print Maglev statistics in machine-readable format")
+DEFINE_BOOL(maglev_regalloc_stats, false,
+            "print per-function Maglev register allocation statistics")
 
 // TODO(v8:7700): Remove once stable.
 DEFINE_BOOL(maglev_function_context_specialization, true,
@@ -847,6 +871,15 @@ DEFINE_BOOL_READONLY(enable_sealed_frozen_elements_kind, true,
 // Flags for data representation optimizations
 DEFINE_BOOL(unbox_double_arrays, true, "automatically unbox arrays of doubles")
 DEFINE_BOOL_READONLY(string_slices, true, "use string slices")
+DEFINE_BOOL(json_parse_map_cache, true,
+            "remember the maps of objects created by JSON.parse across calls")
+DEFINE_BOOL(json_parse_parallel, false,
+            "parse the elements of large top-level JSON arrays on background "
+            "threads")
+DEFINE_INT(json_parse_parallel_min_length, 1 * MB,
+           "minimum source length for parsing JSON in parallel")
+DEFINE_BOOL(trace_json_parse_parallel, false,
+            "trace the parallel parsing of JSON arrays")
 
 // Tiering: Sparkplug / feedback vector allocation.
 DEFINE_INT(invocation_count_for_feedback_allocation, 8,
@@ -1050,6 +1083,9 @@ DEFINE_BOOL(trace_concurrent_recompilation, false,
             "track concurrent recompilation")
 DEFINE_INT(concurrent_recompilation_queue_length, 8,
            "the length of the concurrent compilation queue")
+DEFINE_BOOL(concurrent_recompilation_prioritize, false,
+            "start queued concurrent Turbofan jobs in order of estimated "
+            "benefit (invocations per unit of compile cost) instead of FIFO")
 DEFINE_INT(concurrent_recompilation_delay, 0,
            "artificial compilation delay in ms")
 DEFINE_BOOL(concurrent_recompilation_front_running, true,
@@ -1260,6 +1296,8 @@ DEFINE_BOOL(concurrent_osr, true, "enable concurrent OSR")
 DEFINE_BOOL(maglev_escape_analysis, true,
             "avoid inlined allocation of objects that cannot escape")
 DEFINE_BOOL(trace_maglev_escape_analysis, false, "trace maglev escape analysis")
+DEFINE_BOOL(maglev_escape_analysis_stats, false,
+            "print per-function counts of elided inlined allocations")
 DEFINE_BOOL(maglev_object_tracking, true,
             "track object changes to avoid escaping them")
 DEFINE_WEAK_IMPLICATION(maglev_future, maglev_object_tracking)
@@ -1294,6 +1332,13 @@ DEFINE_STRING(
     turbo_profiling_output, nullptr,
     "emit data about basic block usage in builtins to this file "
     "(requires that V8 was built with v8_enable_builtins_profiling=true)")
+DEFINE_EXPERIMENTAL_FEATURE(
+    turbo_profile_guided_block_layout,
+    "instrument the first optimized version of JS functions with block "
+    "counters and use them to defer cold blocks when re-optimizing")
+DEFINE_BOOL(trace_turbo_profile_guided_block_layout, false,
+            "trace the instrumentation and layout of functions for "
+            "--turbo-profile-guided-block-layout")
 DEFINE_BOOL(reorder_builtins, false,
             "enable builtin reordering when run mksnapshot.")
 
@@ -1322,6 +1367,9 @@ DEFINE_BOOL(turbo_stress_instruction_scheduling, false,
             "randomly schedule instructions to stress dependency tracking")
 DEFINE_IMPLICATION(turbo_stress_instruction_scheduling,
                    turbo_instruction_scheduling)
+DEFINE_STRING(turbo_instruction_scheduling_cpu, "auto",
+              "machine model used by the instruction scheduler: auto, "
+              "generic, skylake, zen (x64) or neoverse (arm64)")
 DEFINE_BOOL(turbo_store_elimination, true,
             "enable store-store elimination in TurboFan")
 DEFINE_BOOL(trace_store_elimination, false, "trace store elimination")
@@ -1435,6 +1483,12 @@ DEFINE_EXPERIMENTAL_FEATURE(turboshaft_from_maglev,
                             "build the Turboshaft graph from Maglev")
 // inline_api_calls are not supported by the Turboshaft->Maglev translation.
 DEFINE_NEG_IMPLICATION(turboshaft_from_maglev, maglev_inline_api_calls)
+DEFINE_EXPERIMENTAL_FEATURE(
+    turboshaft_from_maglev_on_tierup,
+    "build the Turboshaft graph from Maglev for functions that tier up from "
+    "Maglev code, instead of going through the Turbofan graph builder")
+DEFINE_BOOL(trace_turboshaft_from_maglev, false,
+            "trace Turbofan jobs that build the Turboshaft graph from Maglev")
 
 DEFINE_BOOL(turboshaft_csa, true, "run the CSA pipeline with turboshaft")
 DEFINE_IMPLICATION(turboshaft_csa, turboshaft_load_elimination)
@@ -1515,6 +1569,16 @@ DEFINE_BOOL(wasm_generic_wrapper, true,
 DEFINE_INT(wasm_num_compilation_tasks, 128,
            "maximum number of parallel compilation tasks for wasm")
 DEFINE_VALUE_IMPLICATION(single_threaded, wasm_num_compilation_tasks, 0)
+DEFINE_UINT(wasm_compile_memory_budget, 0,
+            "zone memory (in MB) that wasm compilation may use before "
+            "background compilation is throttled to a single task (0 for "
+            "unlimited)")
+DEFINE_UINT(wasm_compile_zone_pool_size, 1 * KB,
+            "maximum total size of zone segments that are kept for reuse by "
+            "later wasm compilation units (in kB)")
+DEFINE_BOOL(trace_wasm_compile_memory, false,
+            "trace the peak zone memory of optimizing wasm compilation per "
+            "module")
 DEFINE_DEBUG_BOOL(trace_wasm_native_heap, false,
                   "trace wasm native heap events")
 DEFINE_BOOL(trace_wasm_offheap_memory, false,
@@ -1528,6 +1592,10 @@ DEFINE_NEG_IMPLICATION(single_threaded, wasm_async_compilation)
 DEFINE_BOOL(wasm_test_streaming, false,
             "use streaming compilation instead of async compilation for tests")
 DEFINE_BOOL(wasm_native_module_cache, true, "enable the native module cache")
+DEFINE_UINT(wasm_native_module_cache_keep_alive, 0,
+            "number of recently used native modules that the native module "
+            "cache keeps alive after their last user died, so that isolates "
+            "compiling the same module later reuse the (tiered-up) code")
 DEFINE_BOOL(turboshaft_wasm_wrappers, false,
             "compile the wasm wrappers with Turboshaft (instead of TurboFan)")
 DEFINE_IMPLICATION(turboshaft_wasm, turboshaft_wasm_wrappers)
@@ -1583,6 +1651,9 @@ DEFINE_BOOL(stress_wasm_stack_switching, false,
             "with a regular (non-JSPI) export")
 DEFINE_INT(wasm_stack_switching_stack_size, V8_DEFAULT_STACK_SIZE_KB,
            "default size of stacks for wasm stack-switching (in kB)")
+DEFINE_UINT(wasm_stack_pool_size, 4 * KB,
+            "maximum total size of the finished wasm stacks that are kept for "
+            "reuse by later stack-switching computations (in kB)")
 DEFINE_BOOL(liftoff, true,
             "enable Liftoff, the baseline compiler for WebAssembly")
 DEFINE_BOOL(liftoff_only, false,
@@ -1754,6 +1825,9 @@ DEFINE_BOOL(wasm_lazy_compilation, true,
             "enable lazy compilation for all wasm modules")
 DEFINE_DEBUG_BOOL(trace_wasm_lazy_compilation, false,
                   "trace lazy compilation of wasm functions")
+DEFINE_BOOL(wasm_lazy_deserialization, false,
+            "defer copying and relocating deserialized wasm code until the "
+            "first call of each function")
 DEFINE_EXPERIMENTAL_FEATURE(
     wasm_lazy_validation,
     "enable lazy validation for lazily compiled wasm functions")
@@ -1816,6 +1890,12 @@ DEFINE_BOOL_READONLY(wasm_memory64_trap_handling, false,
                      "Use trap handling for Wasm memory64 bounds checks (not "
                      "supported for this architecture)")
 #endif  // V8_TARGET_ARCH_ARM64 || V8_TARGET_ARCH_X64
+// The actual value used at runtime is clamped to
+// kV8MaxWasmMemory64GuardRegionMB.
+DEFINE_UINT(wasm_memory64_guard_region_mb, 32,
+            "size of the guard region (in MB) reserved behind memory64 "
+            "memories that use trap handling; accesses with a smaller static "
+            "offset only bounds check their index")
 
 #ifdef V8_ENABLE_DRUMBRAKE
 // DrumBrake flags.
@@ -1838,9 +1918,18 @@ DEFINE_BOOL(redirect_drumbrake_traces, false,
 DEFINE_STRING(
     trace_drumbrake_filter, "*",
     "filter for selecting which wasm functions to trace in the interpreter")
+DEFINE_BOOL(drumbrake_instruction_pair_profile, false,
+            "count pairs of consecutively executed wasm instructions in "
+            "drumbrake and print the most frequent ones on teardown, to select "
+            "candidates for merged instructions")
 #endif  // V8_ENABLE_DRUMBRAKE_TRACING
 DEFINE_BOOL(drumbrake_super_instructions, true,
             "enable drumbrake merged wasm instructions optimization")
+#ifdef V8_ENABLE_DRUMBRAKE_TRACING
+// Profile the unmerged instruction stream.
+DEFINE_NEG_IMPLICATION(drumbrake_instruction_pair_profile,
+                       drumbrake_super_instructions)
+#endif  // V8_ENABLE_DRUMBRAKE_TRACING
 DEFINE_BOOL(drumbrake_register_optimization, true,
             "enable passing the top stack value in a register in drumbrake")
 
@@ -2231,6 +2320,8 @@ DEFINE_BOOL(enable_avx_vnni, true,
             "enable use of AVX-VNNI instructions if available")
 DEFINE_BOOL(enable_avx_vnni_int8, true,
             "enable use of AVX-VNNI-INT8 instructions if available")
+DEFINE_BOOL(enable_avx512, true,
+            "enable use of AVX-512 (F and VL) instructions if available")
 DEFINE_BOOL(enable_fma3, true, "enable use of FMA3 instructions if available")
 DEFINE_BOOL(enable_f16c, true, "enable use of F16C instructions if available")
 DEFINE_BOOL(enable_bmi1, true, "enable use of BMI1 instructions if available")
@@ -3250,6 +3341,7 @@ DEFINE_NEG_IMPLICATION(single_threaded, lazy_compile_dispatcher)
 DEFINE_NEG_IMPLICATION(single_threaded,
                        parallel_compile_tasks_for_eager_toplevel)
 DEFINE_NEG_IMPLICATION(single_threaded, parallel_compile_tasks_for_lazy)
+DEFINE_NEG_IMPLICATION(single_threaded, json_parse_parallel)
 #ifdef V8_ENABLE_MAGLEV
 DEFINE_NEG_IMPLICATION(single_threaded, maglev_deopt_data_on_background)
 DEFINE_NEG_IMPLICATION(single_threaded, maglev_build_code_on_background)
@@ -468,6 +468,11 @@ uint32_t ComputeFlagListHash() {
     // We want to be able to flip --profile-deserialization without
     // causing the code cache to get invalidated by this hash.
     if (flag.PointsTo(&v8_flags.profile_deserialization)) continue;
+#if V8_ENABLE_WEBASSEMBLY
+    // Deferring the relocation of deserialized wasm code does not change the
+    // code, so it does not invalidate the code cache either.
+    if (flag.PointsTo(&v8_flags.wasm_lazy_deserialization)) continue;
+#endif  // V8_ENABLE_WEBASSEMBLY
     // Skip v8_flags.random_seed and v8_flags.predictable to allow predictable
     // code caching.
     if (flag.PointsTo(&v8_flags.random_seed)) continue;
@@ -98,6 +98,7 @@
 #include "src/init/bootstrapper.h"
 #include "src/init/v8.h"
 #include "src/interpreter/interpreter.h"
+#include "src/json/json-parser.h"
 #include "src/logging/log.h"
 #include "src/logging/runtime-call-stats-scope.h"
 #include "src/numbers/conversions.h"
@@ -2744,6 +2745,7 @@ void Heap::MarkCompactPrologue() {
   RegExpResultsCache::Clear(string_split_cache());
   RegExpResultsCache::Clear(regexp_multiple_cache());
   RegExpResultsCache_MatchGlobalAtom::Clear(this);
+  JsonObjectMapCache::Clear(this);
 
   FlushNumberStringCache();
 }
@@ -4265,6 +4267,8 @@ void Heap::EagerlyFreeExternalMemoryAndWasmCode() {
     isolate_->counters()->wasm_flushed_liftoff_metadata_size_bytes()->AddSample(
         static_cast<int>(metadata_size));
   }
+  wasm::GetWasmEngine()->ReleaseCachedNativeModules();
+  wasm::GetWasmEngine()->allocator()->ReleasePooledSegments();
 #endif  // V8_ENABLE_WEBASSEMBLY
   CompleteArrayBufferSweeping(this);
 }
@@ -16,6 +16,7 @@
 #include "src/init/heap-symbols.h"
 #include "src/init/setup-isolate.h"
 #include "src/interpreter/interpreter.h"
+#include "src/json/json-parser.h"
 #include "src/objects/arguments.h"
 #include "src/objects/call-site-info.h"
 #include "src/objects/cell-inl.h"
@@ -1342,6 +1343,9 @@ void Heap::CreateInitialMutableObjects() {
   set_regexp_match_global_atom_cache(*factory->NewFixedArray(
       RegExpResultsCache_MatchGlobalAtom::kSize, AllocationType::kOld));
 
+  set_json_object_map_cache(*factory->NewFixedArray(JsonObjectMapCache::kSize,
+                                                    AllocationType::kOld));
+
   // Allocate FeedbackCell for builtins.
   DirectHandle<FeedbackCell> many_closures_cell =
       factory->NewManyClosuresCell();
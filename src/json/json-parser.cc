@@ -4,7 +4,9 @@
 
 #include "src/json/json-parser.h"
 
+#include <atomic>
 #include <optional>
+#include <vector>
 
 #include "src/base/strings.h"
 #include "src/builtins/builtins.h"
@@ -14,6 +16,7 @@
 #include "src/debug/debug.h"
 #include "src/execution/frames-inl.h"
 #include "src/heap/factory.h"
+#include "src/init/v8.h"
 #include "src/numbers/conversions.h"
 #include "src/numbers/hash-seed-inl.h"
 #include "src/objects/elements-kind.h"
@@ -28,6 +31,10 @@
 #include "src/strings/string-hasher.h"
 #include "src/utils/boxed-float.h"
 
+// Only the statically selected (baseline) target is used, so no dynamic
+// dispatch is needed.
+#include "hwy/highway.h"
+
 namespace v8 {
 namespace internal {
 
@@ -128,6 +135,67 @@ static const constexpr uint8_t character_json_scan_flags[256] = {
 #undef CALL_GET_SCAN_FLAGS
 };
 
+namespace hw = hwy::HWY_NAMESPACE;
+
+// Skips whole vectors of characters that cannot terminate a JSON string, i.e.
+// that contain no '"', '\\' or control character. Returns a position at or
+// before the first such character; the caller scans the rest one character at
+// a time. For two-byte strings, {bits} is updated as if all characters outside
+// of Latin1 in the skipped range were or-ed into it.
+template <typename Char>
+const Char* SkipJsonStringCharacters(const Char* cursor, const Char* end,
+                                     base::uc32* bits) {
+  const hw::ScalableTag<Char> d;
+  const size_t lanes = hw::Lanes(d);
+  const auto quote = hw::Set(d, static_cast<Char>('"'));
+  const auto backslash = hw::Set(d, static_cast<Char>('\\'));
+  const auto space = hw::Set(d, static_cast<Char>(' '));
+  auto seen = hw::Zero(d);
+  while (static_cast<size_t>(end - cursor) >= lanes) {
+    const auto chars = hw::LoadU(d, cursor);
+    const auto terminates =
+        hw::Or(hw::Or(hw::Eq(chars, quote), hw::Eq(chars, backslash)),
+               hw::Lt(chars, space));
+    if (!hw::AllFalse(d, terminates)) break;
+    if constexpr (sizeof(Char) == 2) seen = hw::Or(seen, chars);
+    cursor += lanes;
+  }
+  if constexpr (sizeof(Char) == 2) {
+    // Only whether {bits} exceeds Latin1 matters, and or-ing all characters
+    // exceeds it exactly if one of them does.
+    const auto latin1_max =
+        hw::Set(d, static_cast<Char>(unibrow::Latin1::kMaxChar));
+    if (!hw::AllFalse(d, hw::Gt(seen, latin1_max))) {
+      *bits |= unibrow::Latin1::kMaxChar + 1;
+    }
+  }
+  return cursor;
+}
+
+// Returns the first non-whitespace character in [cursor, end), or a position
+// less than one vector before {end}.
+template <typename Char>
+const Char* SkipJsonWhitespaceRun(const Char* cursor, const Char* end) {
+  const hw::ScalableTag<Char> d;
+  const size_t lanes = hw::Lanes(d);
+  const auto space = hw::Set(d, static_cast<Char>(' '));
+  const auto tab = hw::Set(d, static_cast<Char>('\t'));
+  const auto cr = hw::Set(d, static_cast<Char>('\r'));
+  const auto lf = hw::Set(d, static_cast<Char>('\n'));
+  while (static_cast<size_t>(end - cursor) >= lanes) {
+    const auto chars = hw::LoadU(d, cursor);
+    const auto whitespace =
+        hw::Or(hw::Or(hw::Eq(chars, space), hw::Eq(chars, tab)),
+               hw::Or(hw::Eq(chars, cr), hw::Eq(chars, lf)));
+    const auto other = hw::Not(whitespace);
+    if (!hw::AllFalse(d, other)) {
+      return cursor + hw::FindKnownFirstTrue(d, other);
+    }
+    cursor += lanes;
+  }
+  return cursor;
+}
+
 }  // namespace
 
 MaybeHandle<Object> JsonParseInternalizer::Internalize(
@@ -564,6 +632,14 @@ template <typename Char>
 void JsonParser<Char>::SkipWhitespace() {
   JsonToken local_next = JsonToken::EOS;
 
+  // Most whitespace runs are a single character, but pretty-printed JSON has
+  // long runs of indentation which are worth skipping a vector at a time.
+  if (end_ - cursor_ > 1 &&
+      GetTokenForCharacter(cursor_[0]) == JsonToken::WHITESPACE &&
+      GetTokenForCharacter(cursor_[1]) == JsonToken::WHITESPACE) {
+    cursor_ = SkipJsonWhitespaceRun(cursor_, end_);
+  }
+
   cursor_ = std::find_if(cursor_, end_, [&](Char c) {
     JsonToken current = GetTokenForCharacter(c);
     bool result = current != JsonToken::WHITESPACE;
@@ -1281,19 +1357,71 @@ class JsonParser<Char>::NamedPropertyIterator {
   const JsonProperty* end_;
 };
 
+// static
+Handle<Map> JsonObjectMapCache::Lookup(Isolate* isolate, uint32_t hash) {
+  DisallowGarbageCollection no_gc;
+  Tagged<Object> entry =
+      isolate->heap()->json_object_map_cache()->get(hash % kSize);
+  if (!IsMap(entry)) return {};
+  Tagged<Map> map = Cast<Map>(entry);
+  // Maps of other native contexts have a different Object.prototype.
+  if (map->map()->native_context() != isolate->raw_native_context()) return {};
+  return handle(map, isolate);
+}
+
+// static
+void JsonObjectMapCache::Insert(Isolate* isolate, uint32_t hash,
+                                Tagged<Map> map) {
+  DisallowGarbageCollection no_gc;
+  if (map->is_dictionary_map() || map->IsDetached(isolate)) return;
+  isolate->heap()->json_object_map_cache()->set(hash % kSize, map);
+}
+
+// static
+void JsonObjectMapCache::Clear(Heap* heap) {
+  MemsetTagged(heap->json_object_map_cache()->RawFieldOfFirstElement(),
+               Smi::zero(), kSize);
+}
+
+template <typename Char>
+uint32_t JsonParser<Char>::NamedPropertiesHash(size_t start, size_t end) {
+  // Only the length and the first and last character of each key are hashed;
+  // a collision merely costs a failed check against the cached map.
+  uint32_t hash = 0;
+  for (size_t i = start; i < end; i++) {
+    const JsonString& key = property_stack_[i].string;
+    if (key.is_index()) continue;
+    hash = hash * 31 + key.length();
+    if (key.length() == 0) continue;
+    base::Vector<const Char> chars = GetKeyChars(key);
+    hash = (hash * 31 + chars[0]) * 31 + chars[chars.length() - 1];
+  }
+  return hash;
+}
+
 template <typename Char>
 template <bool should_track_json_source>
 Handle<JSObject> JsonParser<Char>::BuildJsonObject(const JsonContinuation& cont,
                                                    Handle<Map> feedback) {
-  if (!feedback.is_null() && feedback->is_deprecated()) {
-    feedback = Map::Update(isolate_, feedback);
-  }
   size_t start = cont.index;
   DCHECK_LE(start, property_stack_.size());
   int length = static_cast<int>(property_stack_.size() - start);
   int named_length = length - cont.elements;
   DCHECK_LE(0, named_length);
 
+  // Without feedback from a preceding sibling, try the map of an object with
+  // the same keys from this or an earlier parse.
+  const bool use_map_cache =
+      feedback.is_null() && named_length > 0 && v8_flags.json_parse_map_cache;
+  uint32_t map_cache_hash = 0;
+  if (use_map_cache) {
+    map_cache_hash = NamedPropertiesHash(start, property_stack_.size());
+    feedback = JsonObjectMapCache::Lookup(isolate_, map_cache_hash);
+  }
+  if (!feedback.is_null() && feedback->is_deprecated()) {
+    feedback = Map::Update(isolate_, feedback);
+  }
+
   Handle<FixedArrayBase> elements;
   ElementsKind elements_kind = HOLEY_ELEMENTS;
 
@@ -1347,16 +1475,24 @@ Handle<JSObject> JsonParser<Char>::BuildJsonObject(const JsonContinuation& cont,
   NamedPropertyIterator it(*this, property_stack_.begin() + start,
                            property_stack_.end());
 
-  return js_data_object_builder.BuildFromIterator(it, elements);
+  Handle<JSObject> object =
+      js_data_object_builder.BuildFromIterator(it, elements);
+  if (use_map_cache && (feedback.is_null() || object->map() != *feedback)) {
+    JsonObjectMapCache::Insert(isolate_, map_cache_hash, object->map());
+  }
+  return object;
 }
 
-template <typename Char>
-Handle<Object> JsonParser<Char>::BuildJsonArray(size_t start) {
-  int length = static_cast<int>(element_stack_.size() - start);
+namespace {
+
+// Builds an array of {values} with the most specific packed elements kind.
+Handle<JSArray> BuildJsonArrayFromValues(
+    Isolate* isolate, base::Vector<const Handle<Object>> values) {
+  int length = static_cast<int>(values.size());
 
   ElementsKind kind = PACKED_SMI_ELEMENTS;
-  for (size_t i = start; i < element_stack_.size(); i++) {
-    Tagged<Object> value = *element_stack_[i];
+  for (int i = 0; i < length; i++) {
+    Tagged<Object> value = *values[i];
     if (IsHeapObject(value)) {
       if (IsHeapNumber(Cast<HeapObject>(value))) {
         kind = PACKED_DOUBLE_ELEMENTS;
@@ -1367,13 +1503,14 @@ Handle<Object> JsonParser<Char>::BuildJsonArray(size_t start) {
     }
   }
 
-  Handle<JSArray> array = factory()->NewJSArray(kind, length, length);
+  Handle<JSArray> array =
+      isolate->factory()->NewJSArray(kind, length, length);
   if (kind == PACKED_DOUBLE_ELEMENTS) {
     DisallowGarbageCollection no_gc;
     Tagged<FixedDoubleArray> elements =
         Cast<FixedDoubleArray>(array->elements());
     for (int i = 0; i < length; i++) {
-      elements->set(i, Object::NumberValue(*element_stack_[start + i]));
+      elements->set(i, Object::NumberValue(*values[i]));
     }
   } else {
     DisallowGarbageCollection no_gc;
@@ -1382,12 +1519,21 @@ Handle<Object> JsonParser<Char>::BuildJsonArray(size_t start) {
                                 ? SKIP_WRITE_BARRIER
                                 : elements->GetWriteBarrierMode(no_gc);
     for (int i = 0; i < length; i++) {
-      elements->set(i, *element_stack_[start + i], mode);
+      elements->set(i, *values[i], mode);
     }
   }
   return array;
 }
 
+}  // namespace
+
+template <typename Char>
+Handle<Object> JsonParser<Char>::BuildJsonArray(size_t start) {
+  return BuildJsonArrayFromValues(
+      isolate_, base::VectorOf(element_stack_.data() + start,
+                               element_stack_.size() - start));
+}
+
 // Parse rawJSON value.
 template <typename Char>
 bool JsonParser<Char>::ParseRawJson() {
@@ -2120,6 +2266,7 @@ JsonString JsonParser<Char>::ScanJsonString(bool needs_internalization) {
   base::uc32 bits = 0;
 
   while (true) {
+    cursor_ = SkipJsonStringCharacters(cursor_, end_, &bits);
     cursor_ = std::find_if(cursor_, end_, [&bits](Char c) {
       if (sizeof(Char) == 2 && V8_UNLIKELY(c > unibrow::Latin1::kMaxChar)) {
         bits |= c;
@@ -2205,6 +2352,620 @@ JsonString JsonParser<Char>::ScanJsonString(bool needs_internalization) {
   return JsonString();
 }
 
+namespace {
+
+// A JSON value parsed off the main thread. The values of a chunk are stored
+// in pre-order: an array is followed by its elements, and an object by its
+// alternating keys and values. Each entry takes 16 bytes, so the tape of
+// small values like numbers or short strings is larger than their text.
+struct JsonTapeEntry {
+  enum class Kind : uint8_t {
+    kNull,
+    kTrue,
+    kFalse,
+    kNumber,
+    kString,
+    kArray,
+    kObject,
+  };
+
+  Kind kind;
+  // Whether the characters of a string are in the chunk's pool of decoded
+  // strings rather than in the source.
+  bool pooled;
+  // The length of a string, or the number of elements or properties.
+  uint32_t length;
+  union {
+    double number;
+    // The offset of the characters of a string in the source or the pool.
+    uint32_t start;
+  };
+};
+
+// A range of top-level array elements that is parsed as a unit. Element {i}
+// is the text between {boundaries[i]} and {boundaries[i + 1]}, which are the
+// positions of the surrounding '[', ',' or ']'.
+struct JsonParseChunk {
+  base::Vector<const uint32_t> boundaries;
+  std::vector<JsonTapeEntry> tape;
+  std::vector<base::uc16> pool;
+};
+
+template <typename Char>
+const Char* SkipJsonWhitespace(const Char* cursor, const Char* end) {
+  while (cursor != end && (*cursor == ' ' || *cursor == '\t' ||
+                           *cursor == '\n' || *cursor == '\r')) {
+    cursor++;
+  }
+  return cursor;
+}
+
+// Finds the boundaries of the elements of a top-level array. The elements
+// themselves are validated when they are parsed. Returns false if {source} is
+// not an array with at least two elements.
+template <typename Char>
+bool FindJsonArrayElementBoundaries(base::Vector<const Char> source,
+                                    std::vector<uint32_t>* boundaries) {
+  const Char* cursor = SkipJsonWhitespace(source.begin(), source.end());
+  const Char* end = source.end();
+  if (cursor == end || *cursor != '[') return false;
+  boundaries->push_back(static_cast<uint32_t>(cursor - source.begin()));
+  int depth = 0;
+  for (cursor++; cursor != end; cursor++) {
+    switch (*cursor) {
+      case '"':
+        // Escaped characters never end the string.
+        for (cursor++; cursor != end && *cursor != '"'; cursor++) {
+          if (*cursor == '\\' && ++cursor == end) return false;
+        }
+        if (cursor == end) return false;
+        break;
+      case '[':
+      case '{':
+        depth++;
+        break;
+      case '}':
+        if (--depth < 0) return false;
+        break;
+      case ']':
+        if (depth > 0) {
+          depth--;
+          break;
+        }
+        boundaries->push_back(static_cast<uint32_t>(cursor - source.begin()));
+        // Only whitespace may follow the array.
+        return SkipJsonWhitespace(cursor + 1, end) == end &&
+               boundaries->size() > 2;
+      case ',':
+        if (depth == 0) {
+          boundaries->push_back(
+              static_cast<uint32_t>(cursor - source.begin()));
+        }
+        break;
+    }
+  }
+  return false;
+}
+
+// Parses the elements of a chunk into its tape, without accessing the heap.
+// Only the common subset of JSON is supported: keys with escapes or keys that
+// might be array indices, and deep nesting, are rejected like syntax errors,
+// and make the caller fall back to the sequential parser.
+template <typename Char>
+class JsonChunkParser {
+ public:
+  JsonChunkParser(base::Vector<const Char> source, JsonParseChunk* chunk)
+      : source_(source), chunk_(chunk) {}
+
+  bool ParseElements() {
+    base::Vector<const uint32_t> boundaries = chunk_->boundaries;
+    for (size_t i = 0; i + 1 < boundaries.size(); i++) {
+      cursor_ = source_.begin() + boundaries[i] + 1;
+      end_ = source_.begin() + boundaries[i + 1];
+      if (!ParseValue(0)) return false;
+      if (SkipJsonWhitespace(cursor_, end_) != end_) return false;
+    }
+    return true;
+  }
+
+ private:
+  using Kind = JsonTapeEntry::Kind;
+
+  static constexpr int kMaxDepth = 128;
+
+  bool ParseValue(int depth) {
+    cursor_ = SkipJsonWhitespace(cursor_, end_);
+    if (cursor_ == end_) return false;
+    switch (*cursor_) {
+      case '"':
+        return ParseString(false);
+      case '[':
+        return ParseArray(depth + 1);
+      case '{':
+        return ParseObject(depth + 1);
+      case 't':
+        return ParseLiteral("true", Kind::kTrue);
+      case 'f':
+        return ParseLiteral("false", Kind::kFalse);
+      case 'n':
+        return ParseLiteral("null", Kind::kNull);
+      default:
+        return ParseNumber();
+    }
+  }
+
+  bool ParseLiteral(const char* literal, Kind kind) {
+    for (; *literal != '\0'; literal++, cursor_++) {
+      if (cursor_ == end_ || *cursor_ != *literal) return false;
+    }
+    Emit(kind);
+    return true;
+  }
+
+  bool ParseArray(int depth) {
+    if (depth > kMaxDepth) return false;
+    cursor_++;
+    size_t index = Emit(Kind::kArray);
+    uint32_t length = 0;
+    cursor_ = SkipJsonWhitespace(cursor_, end_);
+    if (cursor_ != end_ && *cursor_ == ']') {
+      cursor_++;
+      return true;
+    }
+    while (true) {
+      if (!ParseValue(depth)) return false;
+      length++;
+      cursor_ = SkipJsonWhitespace(cursor_, end_);
+      if (cursor_ == end_) return false;
+      Char c = *cursor_++;
+      if (c == ']') break;
+      if (c != ',') return false;
+    }
+    chunk_->tape[index].length = length;
+    return true;
+  }
+
+  bool ParseObject(int depth) {
+    if (depth > kMaxDepth) return false;
+    cursor_++;
+    size_t index = Emit(Kind::kObject);
+    uint32_t length = 0;
+    cursor_ = SkipJsonWhitespace(cursor_, end_);
+    if (cursor_ != end_ && *cursor_ == '}') {
+      cursor_++;
+      return true;
+    }
+    while (true) {
+      cursor_ = SkipJsonWhitespace(cursor_, end_);
+      if (cursor_ == end_ || *cursor_ != '"' || !ParseString(true)) {
+        return false;
+      }
+      cursor_ = SkipJsonWhitespace(cursor_, end_);
+      if (cursor_ == end_ || *cursor_++ != ':') return false;
+      if (!ParseValue(depth)) return false;
+      length++;
+      cursor_ = SkipJsonWhitespace(cursor_, end_);
+      if (cursor_ == end_) return false;
+      Char c = *cursor_++;
+      if (c == '}') break;
+      if (c != ',') return false;
+    }
+    chunk_->tape[index].length = length;
+    return true;
+  }
+
+  bool ParseString(bool is_key) {
+    const Char* start = ++cursor_;
+    while (cursor_ != end_ && *cursor_ != '"' && *cursor_ != '\\' &&
+           *cursor_ >= 0x20) {
+      cursor_++;
+    }
+    if (cursor_ == end_) return false;
+    if (*cursor_ == '"') {
+      // Keys that are array indices are stored as elements.
+      if (is_key && start != cursor_ && IsDecimalDigit(*start)) return false;
+      EmitString(false, static_cast<uint32_t>(start - source_.begin()),
+                 static_cast<uint32_t>(cursor_ - start));
+      cursor_++;
+      return true;
+    }
+    if (is_key || *cursor_ != '\\') return false;
+
+    std::vector<base::uc16>& pool = chunk_->pool;
+    size_t pool_start = pool.size();
+    pool.insert(pool.end(), start, cursor_);
+    while (true) {
+      if (cursor_ == end_) return false;
+      Char c = *cursor_++;
+      if (c == '"') break;
+      if (c < 0x20) return false;
+      if (c != '\\') {
+        pool.push_back(c);
+        continue;
+      }
+      if (cursor_ == end_) return false;
+      switch (*cursor_++) {
+        case '"':
+          pool.push_back('"');
+          break;
+        case '\\':
+          pool.push_back('\\');
+          break;
+        case '/':
+          pool.push_back('/');
+          break;
+        case 'b':
+          pool.push_back('\b');
+          break;
+        case 'f':
+          pool.push_back('\f');
+          break;
+        case 'n':
+          pool.push_back('\n');
+          break;
+        case 'r':
+          pool.push_back('\r');
+          break;
+        case 't':
+          pool.push_back('\t');
+          break;
+        case 'u': {
+          if (end_ - cursor_ < 4) return false;
+          int value = 0;
+          for (int i = 0; i < 4; i++) {
+            int digit = base::HexValue(*cursor_++);
+            if (digit < 0) return false;
+            value = value * 16 + digit;
+          }
+          pool.push_back(static_cast<base::uc16>(value));
+          break;
+        }
+        default:
+          return false;
+      }
+    }
+    EmitString(true, static_cast<uint32_t>(pool_start),
+               static_cast<uint32_t>(pool.size() - pool_start));
+    return true;
+  }
+
+  bool ParseNumber() {
+    const Char* start = cursor_;
+    bool negative = *cursor_ == '-';
+    if (negative) cursor_++;
+    const Char* digits = cursor_;
+    if (cursor_ == end_ || !IsDecimalDigit(*cursor_)) return false;
+    // A leading zero must be the only digit before the fraction or exponent.
+    if (*cursor_ == '0') {
+      cursor_++;
+    } else {
+      SkipDecimalDigits();
+    }
+    bool is_integer = true;
+    if (cursor_ != end_ && *cursor_ == '.') {
+      is_integer = false;
+      cursor_++;
+      if (cursor_ == end_ || !IsDecimalDigit(*cursor_)) return false;
+      SkipDecimalDigits();
+    }
+    if (cursor_ != end_ && AsciiAlphaToLower(*cursor_) == 'e') {
+      is_integer = false;
+      cursor_++;
+      if (cursor_ != end_ && (*cursor_ == '-' || *cursor_ == '+')) cursor_++;
+      if (cursor_ == end_ || !IsDecimalDigit(*cursor_)) return false;
+      SkipDecimalDigits();
+    }
+
+    double number;
+    // Integers of up to 9 digits are exact without going through
+    // StringToDouble.
+    constexpr int kMaxExactIntegerLength = 9;
+    if (is_integer && cursor_ - digits <= kMaxExactIntegerLength) {
+      int32_t value = 0;
+      for (const Char* c = digits; c != cursor_; c++) {
+        value = value * 10 + (*c - '0');
+      }
+      number = negative ? -static_cast<double>(value) : value;
+    } else {
+      number = StringToDouble(base::Vector<const Char>(start, cursor_ - start),
+                              NO_CONVERSION_FLAG,
+                              std::numeric_limits<double>::quiet_NaN());
+      DCHECK(!std::isnan(number));
+    }
+    size_t index = Emit(Kind::kNumber);
+    chunk_->tape[index].number = number;
+    return true;
+  }
+
+  void SkipDecimalDigits() {
+    while (cursor_ != end_ && IsDecimalDigit(*cursor_)) cursor_++;
+  }
+
+  size_t Emit(Kind kind) {
+    JsonTapeEntry entry;
+    entry.kind = kind;
+    entry.pooled = false;
+    entry.length = 0;
+    chunk_->tape.push_back(entry);
+    return chunk_->tape.size() - 1;
+  }
+
+  void EmitString(bool pooled, uint32_t start, uint32_t length) {
+    JsonTapeEntry& entry = chunk_->tape[Emit(Kind::kString)];
+    entry.pooled = pooled;
+    entry.length = length;
+    entry.start = start;
+  }
+
+  const base::Vector<const Char> source_;
+  JsonParseChunk* const chunk_;
+  const Char* cursor_ = nullptr;
+  const Char* end_ = nullptr;
+};
+
+// Parses chunks on background threads, claiming them one at a time.
+template <typename Char>
+class JsonParseChunksJob final : public JobTask {
+ public:
+  JsonParseChunksJob(base::Vector<const Char> source,
+                     std::vector<JsonParseChunk>* chunks,
+                     std::atomic<bool>* failed_out)
+      : source_(source), chunks_(chunks), failed_out_(failed_out) {}
+
+  void Run(JobDelegate* delegate) override {
+    do {
+      size_t index = next_chunk_.fetch_add(1, std::memory_order_relaxed);
+      if (index >= chunks_->size()) return;
+      JsonChunkParser<Char> parser(source_, &(*chunks_)[index]);
+      if (!parser.ParseElements()) {
+        failed_out_->store(true, std::memory_order_relaxed);
+        // No need to parse any more chunks.
+        next_chunk_.store(chunks_->size(), std::memory_order_relaxed);
+        return;
+      }
+    } while (!delegate->ShouldYield());
+  }
+
+  size_t GetMaxConcurrency(size_t /* worker_count */) const override {
+    size_t next_chunk = next_chunk_.load(std::memory_order_relaxed);
+    return chunks_->size() - std::min(next_chunk, chunks_->size());
+  }
+
+ private:
+  const base::Vector<const Char> source_;
+  std::vector<JsonParseChunk>* const chunks_;
+  std::atomic<bool>* const failed_out_;
+  std::atomic<size_t> next_chunk_{0};
+};
+
+Handle<Map> SiblingFeedback(Isolate* isolate, Tagged<Object> value) {
+  if (!IsJSObject(value)) return {};
+  Tagged<Map> map = Cast<JSObject>(value)->map();
+  // Don't consume feedback from objects with a map that's detached from the
+  // transition tree.
+  if (map->IsDetached(isolate)) return {};
+  return handle(map, isolate);
+}
+
+// Creates the values of a chunk's tape on the main thread.
+template <typename Char>
+class JsonTapeMaterializer {
+ public:
+  JsonTapeMaterializer(Isolate* isolate, base::Vector<const Char> source,
+                       const JsonParseChunk& chunk)
+      : isolate_(isolate), source_(source), chunk_(chunk) {}
+
+  Handle<Object> MaterializeValue(Handle<Map> feedback) {
+    const JsonTapeEntry& entry = chunk_.tape[position_++];
+    switch (entry.kind) {
+      case JsonTapeEntry::Kind::kNull:
+        return factory()->null_value();
+      case JsonTapeEntry::Kind::kTrue:
+        return factory()->true_value();
+      case JsonTapeEntry::Kind::kFalse:
+        return factory()->false_value();
+      case JsonTapeEntry::Kind::kNumber:
+        return factory()->NewNumber(entry.number);
+      case JsonTapeEntry::Kind::kString:
+        return MakeString(entry);
+      case JsonTapeEntry::Kind::kArray:
+        return MaterializeArray(entry.length);
+      case JsonTapeEntry::Kind::kObject:
+        return MaterializeObject(entry.length, feedback);
+    }
+    UNREACHABLE();
+  }
+
+  bool done() const { return position_ == chunk_.tape.size(); }
+
+ private:
+  class PropertyIterator {
+   public:
+    PropertyIterator(JsonTapeMaterializer* materializer, uint32_t length)
+        : materializer_(materializer), length_(length) {
+      values_.reserve(length);
+      if (length_ > 0) NextKey();
+    }
+
+    void Advance() {
+      DCHECK_EQ(values_.size(), index_ + 1);
+      if (++index_ < length_) NextKey();
+    }
+
+    bool Done() const { return index_ == length_; }
+
+    base::Vector<const Char> GetKeyChars() {
+      return materializer_->SourceChars(key());
+    }
+    Handle<String> GetKey(Handle<String> expected_key_hint) {
+      return materializer_->MakeKey(key(), expected_key_hint);
+    }
+    Handle<Object> GetValue(bool will_revisit_value) {
+      // The value of a property whose fast path failed is requested again by
+      // the slow path.
+      if (values_.size() == index_) {
+        values_.push_back(materializer_->MaterializeValue({}));
+      }
+      return values_[index_];
+    }
+    const Handle<Object>* RevisitValues() { return values_.data(); }
+
+   private:
+    const JsonTapeEntry& key() const {
+      return materializer_->chunk_.tape[key_position_];
+    }
+    void NextKey() { key_position_ = materializer_->position_++; }
+
+    JsonTapeMaterializer* const materializer_;
+    const uint32_t length_;
+    uint32_t index_ = 0;
+    size_t key_position_ = 0;
+    std::vector<Handle<Object>> values_;
+  };
+
+  Handle<Object> MaterializeArray(uint32_t length) {
+    if (length == 0) return factory()->NewJSArray(0, PACKED_SMI_ELEMENTS);
+    std::vector<Handle<Object>> values;
+    values.reserve(length);
+    Handle<Map> feedback;
+    for (uint32_t i = 0; i < length; i++) {
+      values.push_back(MaterializeValue(feedback));
+      feedback = SiblingFeedback(isolate_, *values.back());
+    }
+    return BuildJsonArrayFromValues(isolate_, base::VectorOf(values));
+  }
+
+  Handle<Object> MaterializeObject(uint32_t length, Handle<Map> feedback) {
+    if (!feedback.is_null() && feedback->is_deprecated()) {
+      feedback = Map::Update(isolate_, feedback);
+    }
+    // Every number is materialized into a fresh HeapNumber.
+    JSDataObjectBuilder js_data_object_builder(
+        isolate_, HOLEY_ELEMENTS, length, feedback,
+        JSDataObjectBuilder::kHeapNumbersGuaranteedUniquelyOwned);
+    PropertyIterator it(this, length);
+    return js_data_object_builder.BuildFromIterator(it);
+  }
+
+  base::Vector<const Char> SourceChars(const JsonTapeEntry& entry) const {
+    DCHECK(!entry.pooled);
+    return source_.SubVector(entry.start, entry.start + entry.length);
+  }
+
+  Handle<String> MakeKey(const JsonTapeEntry& entry, Handle<String> hint) {
+    base::Vector<const Char> chars = SourceChars(entry);
+    if (!hint.is_null() && Matches(chars, hint)) return hint;
+    bool convert = false;
+    if constexpr (sizeof(Char) == 2) {
+      convert = String::IsOneByte(chars.begin(), entry.length);
+    }
+    return factory()->InternalizeString(chars, convert);
+  }
+
+  Handle<String> MakeString(const JsonTapeEntry& entry) {
+    if (entry.length == 0) return factory()->empty_string();
+    if (entry.pooled) {
+      base::Vector<const base::uc16> chars(chunk_.pool.data() + entry.start,
+                                           entry.length);
+      return factory()->NewStringFromTwoByte(chars).ToHandleChecked();
+    }
+    base::Vector<const Char> chars = SourceChars(entry);
+    if constexpr (sizeof(Char) == 1) {
+      // Like JsonParser, internalize short one-byte strings.
+      constexpr int kMaxInternalizedStringValueLength = 10;
+      if (chars.length() < kMaxInternalizedStringValueLength) {
+        return factory()->InternalizeString(chars);
+      }
+      return factory()->NewStringFromOneByte(chars).ToHandleChecked();
+    } else {
+      return factory()->NewStringFromTwoByte(chars).ToHandleChecked();
+    }
+  }
+
+  Factory* factory() const { return isolate_->factory(); }
+
+  Isolate* const isolate_;
+  const base::Vector<const Char> source_;
+  const JsonParseChunk& chunk_;
+  size_t position_ = 0;
+};
+
+}  // namespace
+
+// static
+template <typename Char>
+MaybeHandle<Object> JsonParser<Char>::ParseInParallel(Isolate* isolate,
+                                                      Handle<String> source) {
+  DCHECK(!v8_flags.single_threaded);
+  if (source->length() <
+      static_cast<uint32_t>(v8_flags.json_parse_parallel_min_length)) {
+    return {};
+  }
+
+  // Copy the source, so that background threads can read it while the main
+  // thread allocates. Together with the tapes, this needs several times the
+  // memory of the source on top of what the sequential parser needs. Reading
+  // the string itself would require the materialization below to cope with
+  // the string being moved by GC, like the sequential parser does.
+  source = String::Flatten(isolate, source);
+  DCHECK_EQ(sizeof(Char) == 1, source->IsOneByteRepresentation());
+  std::vector<Char> chars(source->length());
+  String::WriteToFlat(*source, chars.data(), 0, source->length());
+  base::Vector<const Char> source_chars = base::VectorOf(chars);
+
+  std::vector<uint32_t> boundaries;
+  if (!FindJsonArrayElementBoundaries(source_chars, &boundaries)) return {};
+
+  // Split the elements into a few chunks per thread, which threads claim
+  // dynamically to balance elements of different sizes.
+  constexpr size_t kChunksPerThread = 4;
+  const size_t element_count = boundaries.size() - 1;
+  const size_t thread_count = static_cast<size_t>(
+      V8::GetCurrentPlatform()->NumberOfWorkerThreads() + 1);
+  const size_t chunk_count =
+      std::min(element_count, thread_count * kChunksPerThread);
+  std::vector<JsonParseChunk> chunks(chunk_count);
+  for (size_t i = 0; i < chunk_count; i++) {
+    size_t first = element_count * i / chunk_count;
+    size_t last = element_count * (i + 1) / chunk_count;
+    chunks[i].boundaries =
+        base::VectorOf(boundaries.data() + first, last - first + 1);
+  }
+
+  std::atomic<bool> failed{false};
+  V8::GetCurrentPlatform()
+      ->CreateJob(TaskPriority::kUserBlocking,
+                  std::make_unique<JsonParseChunksJob<Char>>(
+                      source_chars, &chunks, &failed))
+      ->Join();
+  // Let the sequential parser report any errors.
+  if (failed.load(std::memory_order_relaxed)) {
+    if (V8_UNLIKELY(v8_flags.trace_json_parse_parallel)) {
+      PrintF("[json-parse-parallel: falling back to the sequential parser]\n");
+    }
+    return {};
+  }
+  if (V8_UNLIKELY(v8_flags.trace_json_parse_parallel)) {
+    PrintF("[json-parse-parallel: parsed %zu elements in %zu chunks]\n",
+           element_count, chunk_count);
+  }
+
+  std::vector<Handle<Object>> elements;
+  elements.reserve(element_count);
+  Handle<Map> feedback;
+  for (const JsonParseChunk& chunk : chunks) {
+    JsonTapeMaterializer<Char> materializer(isolate, source_chars, chunk);
+    for (size_t i = 1; i < chunk.boundaries.size(); i++) {
+      HandleScope scope(isolate);
+      Handle<Object> element = materializer.MaterializeValue(feedback);
+      elements.push_back(scope.CloseAndEscape(element));
+      feedback = SiblingFeedback(isolate, *elements.back());
+    }
+    DCHECK(materializer.done());
+  }
+  return BuildJsonArrayFromValues(isolate, base::VectorOf(elements));
+}
+
 // Explicit instantiation.
 template class JsonParser<uint8_t>;
 template class JsonParser<uint16_t>;
@@ -150,6 +150,22 @@ enum class JsonToken : uint8_t {
   EOS
 };
 
+// A per-isolate cache of the maps of objects created by JSON.parse, keyed by
+// a hash of their property keys. Objects with the same keys, e.g. the records
+// of documents that are parsed again and again, are then built directly in
+// their final map, and their keys are matched against the map's descriptors
+// instead of being looked up in the string table. Entries are only hints;
+// the keys of a cached map are checked while building the object. The cache
+// is cleared on every mark-compact GC.
+class JsonObjectMapCache final : public AllStatic {
+ public:
+  static Handle<Map> Lookup(Isolate* isolate, uint32_t hash);
+  static void Insert(Isolate* isolate, uint32_t hash, Tagged<Map> map);
+  static void Clear(Heap* heap);
+
+  static constexpr int kSize = 64;
+};
+
 // A simple json parser.
 template <typename Char>
 class JsonParser final {
@@ -167,6 +183,10 @@ class JsonParser final {
     HighAllocationThroughputScope high_throughput_scope(
         V8::GetCurrentPlatform());
     Handle<Object> result;
+    if (V8_UNLIKELY(v8_flags.json_parse_parallel) && !IsCallable(*reviver) &&
+        ParseInParallel(isolate, source).ToHandle(&result)) {
+      return result;
+    }
     MaybeHandle<Object> val_node;
     {
       JsonParser parser(isolate, source);
@@ -180,6 +200,13 @@ class JsonParser final {
     return result;
   }
 
+  // Parses the elements of a large top-level array on background threads.
+  // Returns an empty handle without throwing if {source} is not eligible or
+  // not valid JSON, in which case the caller falls back to the sequential
+  // parser, which also reports any syntax error.
+  static MaybeHandle<Object> ParseInParallel(Isolate* isolate,
+                                             Handle<String> source);
+
   static constexpr base::uc32 kEndOfString = static_cast<base::uc32>(-1);
   static constexpr base::uc32 kInvalidUnicodeCharacter =
       static_cast<base::uc32>(-1);
@@ -303,6 +330,9 @@ class JsonParser final {
   base::Vector<const Char> GetKeyChars(JsonString key) {
     return base::Vector<const Char>(chars_ + key.start(), key.length());
   }
+  // Returns the {JsonObjectMapCache} hash of the named properties in
+  // [start, end) of the property stack.
+  uint32_t NamedPropertiesHash(size_t start, size_t end);
   Handle<String> MakeString(const JsonString& string,
                             Handle<String> hint = Handle<String>());
 
@@ -0,0 +1,201 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/json/json-streaming-parser.h"
+
+#include <algorithm>
+
+#include "src/handles/global-handles-inl.h"
+#include "src/heap/factory.h"
+#include "src/json/json-parser.h"
+#include "src/objects/fixed-array-inl.h"
+#include "src/objects/js-array-inl.h"
+
+namespace v8 {
+namespace internal {
+
+namespace {
+
+constexpr bool IsJsonWhitespace(uint8_t c) {
+  return c == ' ' || c == '\t' || c == '\n' || c == '\r';
+}
+
+MaybeHandle<Object> ParseText(Isolate* isolate,
+                              base::Vector<const uint8_t> text) {
+  Handle<String> source;
+  ASSIGN_RETURN_ON_EXCEPTION(isolate, source,
+                             isolate->factory()->NewStringFromUtf8(
+                                 base::Vector<const char>::cast(text)));
+  source = String::Flatten(isolate, source);
+  Handle<Object> undefined = isolate->factory()->undefined_value();
+  return source->IsOneByteRepresentation()
+             ? JsonParser<uint8_t>::Parse(isolate, source, undefined)
+             : JsonParser<uint16_t>::Parse(isolate, source, undefined);
+}
+
+}  // namespace
+
+JsonStreamingParser::JsonStreamingParser(Isolate* isolate)
+    : isolate_(isolate) {}
+
+JsonStreamingParser::~JsonStreamingParser() {
+  if (!elements_.is_null()) GlobalHandles::Destroy(elements_.location());
+}
+
+bool JsonStreamingParser::Write(base::Vector<const uint8_t> chunk) {
+  DCHECK(!has_failed());
+  buffer_.insert(buffer_.end(), chunk.begin(), chunk.end());
+  if (state_ == State::kStart) {
+    while (position_ < buffer_.size() && IsJsonWhitespace(buffer_[position_])) {
+      position_++;
+    }
+    if (position_ == buffer_.size()) return true;
+    if (buffer_[position_] != '[') {
+      state_ = State::kBuffering;
+      return true;
+    }
+    SetElements(ArrayList::New(isolate_, 16));
+    state_ = State::kElement;
+    element_start_ = ++position_;
+  }
+  if (state_ == State::kBuffering) return true;
+  if (!ScanElements()) {
+    state_ = State::kFailed;
+    buffer_.clear();
+    return false;
+  }
+  // Drop the text of the elements that have been parsed.
+  buffer_.erase(buffer_.begin(), buffer_.begin() + element_start_);
+  position_ -= element_start_;
+  element_start_ = 0;
+  return true;
+}
+
+bool JsonStreamingParser::ScanElements() {
+  for (; position_ < buffer_.size(); position_++) {
+    const uint8_t c = buffer_[position_];
+    if (state_ == State::kEnd) {
+      if (!IsJsonWhitespace(c)) {
+        ReportTrailingCharacters();
+        return false;
+      }
+      element_start_ = position_ + 1;
+      continue;
+    }
+    DCHECK_EQ(state_, State::kElement);
+    if (in_string_) {
+      // Multi-byte UTF-8 sequences never contain ASCII bytes, so they can be
+      // skipped byte by byte.
+      if (escaped_) {
+        escaped_ = false;
+      } else if (c == '\\') {
+        escaped_ = true;
+      } else if (c == '"') {
+        in_string_ = false;
+      }
+      continue;
+    }
+    switch (c) {
+      case '"':
+        in_string_ = true;
+        break;
+      case '[':
+      case '{':
+        depth_++;
+        break;
+      case '}':
+        // Unbalanced braces are reported when parsing the element.
+        if (depth_ > 0) depth_--;
+        break;
+      case ']':
+        if (depth_ > 0) {
+          depth_--;
+          break;
+        }
+        // Nothing but whitespace between the brackets is an empty array.
+        if (after_comma_ ||
+            !std::all_of(buffer_.begin() + element_start_,
+                         buffer_.begin() + position_, IsJsonWhitespace)) {
+          if (!ParseElement(position_)) return false;
+        }
+        state_ = State::kEnd;
+        element_start_ = position_ + 1;
+        break;
+      case ',':
+        if (depth_ > 0) break;
+        if (!ParseElement(position_)) return false;
+        after_comma_ = true;
+        element_start_ = position_ + 1;
+        break;
+    }
+  }
+  return true;
+}
+
+bool JsonStreamingParser::ParseElement(size_t end) {
+  HandleScope scope(isolate_);
+  DCHECK_LE(element_start_, end);
+  Handle<Object> element;
+  if (!ParseText(isolate_, base::VectorOf(buffer_.data() + element_start_,
+                                          end - element_start_))
+           .ToHandle(&element)) {
+    return false;
+  }
+  SetElements(ArrayList::Add(isolate_, elements_, element));
+  return true;
+}
+
+void JsonStreamingParser::ReportTrailingCharacters() {
+  // Let the JsonParser report the error, as if the array had been empty.
+  std::vector<uint8_t> text = {'[', ']'};
+  text.insert(text.end(), buffer_.begin() + position_, buffer_.end());
+  MaybeHandle<Object> result = ParseText(isolate_, base::VectorOf(text));
+  DCHECK(result.is_null());
+  USE(result);
+}
+
+MaybeHandle<Object> JsonStreamingParser::Finish() {
+  DCHECK(!has_failed());
+  MaybeHandle<Object> result;
+  switch (state_) {
+    case State::kStart:
+    case State::kBuffering:
+      result = ParseText(isolate_, base::VectorOf(buffer_));
+      break;
+    case State::kElement: {
+      // The array is unterminated. Let the JsonParser report the error for
+      // the text of the current element.
+      std::vector<uint8_t> text = {'['};
+      text.insert(text.end(), buffer_.begin() + element_start_,
+                  buffer_.end());
+      result = ParseText(isolate_, base::VectorOf(text));
+      DCHECK(result.is_null());
+      break;
+    }
+    case State::kEnd: {
+      Handle<FixedArray> elements =
+          ArrayList::ToFixedArray(isolate_, elements_);
+      result = isolate_->factory()->NewJSArrayWithElements(
+          elements, PACKED_ELEMENTS, elements->length());
+      break;
+    }
+    case State::kFailed:
+      UNREACHABLE();
+  }
+  buffer_.clear();
+  buffer_.shrink_to_fit();
+  if (result.is_null()) state_ = State::kFailed;
+  return result;
+}
+
+void JsonStreamingParser::SetElements(DirectHandle<ArrayList> elements) {
+  if (!elements_.is_null()) {
+    if (*elements == *elements_) return;
+    GlobalHandles::Destroy(elements_.location());
+  }
+  elements_ = isolate_->global_handles()->Create(*elements);
+}
+
+}  // namespace internal
+}  // namespace v8
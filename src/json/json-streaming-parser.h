@@ -0,0 +1,90 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_JSON_JSON_STREAMING_PARSER_H_
+#define V8_JSON_JSON_STREAMING_PARSER_H_
+
+#include <vector>
+
+#include "src/base/vector.h"
+#include "src/handles/handles.h"
+#include "src/objects/objects.h"
+
+namespace v8 {
+namespace internal {
+
+class ArrayList;
+
+// Parses UTF-8 encoded JSON text that is provided in chunks.
+//
+// If the text is a top-level array, which is the common shape of large
+// inputs, a resumable scanner tracks the nesting depth and string state of
+// the bytes seen so far. Each element is parsed with the regular JsonParser
+// as soon as it is complete, and its text is dropped, so that only the
+// current element has to be buffered. Any other text is buffered and parsed
+// in one go by {Finish}, which first copies the buffer into a String.
+//
+// Every element gets its own String and JsonParser, so per-element overhead
+// dominates for arrays of small elements. Making JsonParser itself resumable
+// would avoid both this and the copy of non-array text.
+//
+// The scanner only looks for the ',' and ']' that separate top-level
+// elements; the elements themselves are fully validated by the JsonParser.
+// Syntax errors inside an element report positions relative to the start of
+// that element.
+class V8_EXPORT_PRIVATE JsonStreamingParser final {
+ public:
+  explicit JsonStreamingParser(Isolate* isolate);
+  ~JsonStreamingParser();
+  JsonStreamingParser(const JsonStreamingParser&) = delete;
+  JsonStreamingParser& operator=(const JsonStreamingParser&) = delete;
+
+  // Consumes the next chunk of text. Returns false if an exception was
+  // thrown, after which the parser must not be used anymore.
+  V8_WARN_UNUSED_RESULT bool Write(base::Vector<const uint8_t> chunk);
+
+  // Returns the parsed value once all of the text has been written.
+  V8_WARN_UNUSED_RESULT MaybeHandle<Object> Finish();
+
+  bool has_failed() const { return state_ == State::kFailed; }
+
+ private:
+  enum class State {
+    // Skipping whitespace before the top-level value.
+    kStart,
+    // Inside a top-level array, scanning for the end of the current element.
+    kElement,
+    // After the top-level array; only whitespace may follow.
+    kEnd,
+    // The top-level value is not an array, and is parsed by {Finish}.
+    kBuffering,
+    kFailed,
+  };
+
+  bool ScanElements();
+  bool ParseElement(size_t end);
+  MaybeHandle<Object> ParseBuffer(size_t start, size_t end);
+  void ReportTrailingCharacters();
+  void SetElements(DirectHandle<ArrayList> elements);
+
+  Isolate* const isolate_;
+  State state_ = State::kStart;
+  // Text that has not been parsed yet. Offsets below are relative to it.
+  std::vector<uint8_t> buffer_;
+  size_t position_ = 0;
+  size_t element_start_ = 0;
+  // Scanner state within the current element.
+  int depth_ = 0;
+  bool in_string_ = false;
+  bool escaped_ = false;
+  // Whether the current element follows a ',' and thus must not be empty.
+  bool after_comma_ = false;
+  // The elements parsed so far, held by a global handle.
+  IndirectHandle<ArrayList> elements_;
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_JSON_JSON_STREAMING_PARSER_H_
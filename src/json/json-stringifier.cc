@@ -21,9 +21,84 @@
 #include "src/objects/tagged.h"
 #include "src/strings/string-builder-inl.h"
 
+// Only the statically selected (baseline) target is used, so no dynamic
+// dispatch is needed.
+#include "hwy/highway.h"
+
 namespace v8 {
 namespace internal {
 
+namespace {
+
+namespace hw = hwy::HWY_NAMESPACE;
+
+// Returns whether {c} is escaped when serialized, or is a surrogate. Lone
+// surrogates are escaped, surrogate pairs are copied as-is; telling them apart
+// is left to the caller.
+template <typename Char>
+V8_INLINE bool IsJsonEscapeCandidate(Char c) {
+  if (sizeof(Char) != 1 && (c & 0xF800) == 0xD800) return true;
+  return c < 0x20 || c == '"' || c == '\\';
+}
+
+// Vector version of {IsJsonEscapeCandidate}.
+template <typename D, typename V>
+V8_INLINE auto JsonEscapeCandidates(D d, V chars) {
+  using Char = hw::TFromD<D>;
+  const auto candidates =
+      hw::Or(hw::Or(hw::Eq(chars, hw::Set(d, static_cast<Char>('"'))),
+                    hw::Eq(chars, hw::Set(d, static_cast<Char>('\\')))),
+             hw::Lt(chars, hw::Set(d, static_cast<Char>(0x20))));
+  if constexpr (sizeof(Char) == 1) {
+    return candidates;
+  } else {
+    const auto surrogate =
+        hw::Eq(hw::And(chars, hw::Set(d, static_cast<Char>(0xF800))),
+               hw::Set(d, static_cast<Char>(0xD800)));
+    return hw::Or(candidates, surrogate);
+  }
+}
+
+// Returns the index of the first escape candidate in {chars} at or after
+// {from}, or the length of {chars} if there is none.
+template <typename Char>
+int FindJsonEscapeCandidate(base::Vector<const Char> chars, int from) {
+  const hw::ScalableTag<Char> d;
+  const size_t lanes = hw::Lanes(d);
+  const Char* cursor = chars.begin() + from;
+  const Char* end = chars.end();
+  while (static_cast<size_t>(end - cursor) >= lanes) {
+    const auto candidates = JsonEscapeCandidates(d, hw::LoadU(d, cursor));
+    if (!hw::AllFalse(d, candidates)) {
+      cursor += hw::FindKnownFirstTrue(d, candidates);
+      return static_cast<int>(cursor - chars.begin());
+    }
+    cursor += lanes;
+  }
+  while (cursor != end && !IsJsonEscapeCandidate(*cursor)) cursor++;
+  return static_cast<int>(cursor - chars.begin());
+}
+
+// Returns the number of escape candidates in {chars}.
+template <typename Char>
+size_t CountJsonEscapeCandidates(base::Vector<const Char> chars) {
+  const hw::ScalableTag<Char> d;
+  const size_t lanes = hw::Lanes(d);
+  const Char* cursor = chars.begin();
+  const Char* end = chars.end();
+  size_t count = 0;
+  while (static_cast<size_t>(end - cursor) >= lanes) {
+    count += hw::CountTrue(d, JsonEscapeCandidates(d, hw::LoadU(d, cursor)));
+    cursor += lanes;
+  }
+  for (; cursor != end; cursor++) {
+    if (IsJsonEscapeCandidate(*cursor)) count++;
+  }
+  return count;
+}
+
+}  // namespace
+
 class JsonStringifier {
  public:
   explicit JsonStringifier(Isolate* isolate);
@@ -365,6 +440,13 @@ class JsonStringifier {
   V8_INLINE static bool SerializeStringUnchecked_(
       base::Vector<const SrcChar> src, NoExtendBuilder<DestChar>* dest);
 
+  // Grows the current part such that the escaped {chars} fit into it, based
+  // on an exact count of the characters that might need escaping. Returns
+  // false if the result would be too long, in which case the caller has to
+  // take the slow path that extends the part on demand.
+  template <typename SrcChar, bool raw_json>
+  V8_NOINLINE bool TryReserveEscapedLength(base::Vector<const SrcChar> chars);
+
   // Returns whether any escape sequences were used.
   template <typename SrcChar, typename DestChar, bool raw_json>
   V8_INLINE bool SerializeString_(Tagged<String> string,
@@ -407,6 +489,7 @@ class JsonStringifier {
   Factory* factory() { return isolate_->factory(); }
 
   V8_NOINLINE void Extend();
+  void ResizePart(int new_length);
   V8_NOINLINE void ChangeEncoding();
 
   Isolate* isolate_;
@@ -1423,6 +1506,10 @@ bool JsonStringifier::SerializeStringUnchecked_(
   bool required_escaping = false;
   int prev_escaped_offset = -1;
   for (int i = 0; i < src.length(); i++) {
+    if constexpr (!raw_json) {
+      i = FindJsonEscapeCandidate(src, i);
+      if (i == src.length()) break;
+    }
     SrcChar c = src[i];
     if (raw_json || DoNotEscape(c)) {
       continue;
@@ -1483,6 +1570,24 @@ bool JsonStringifier::SerializeStringUnchecked_(
   return required_escaping;
 }
 
+template <typename SrcChar, bool raw_json>
+bool JsonStringifier::TryReserveEscapedLength(
+    base::Vector<const SrcChar> chars) {
+  if (part_length_ >= String::kMaxLength) return false;
+  // The worst case length of an escaped character is 6 ("\\uXXXX"), whereas
+  // surrogate pairs are copied unchanged.
+  size_t escaped_length = chars.size();
+  if (!raw_json) escaped_length += 5 * CountJsonEscapeCandidates(chars);
+  if (escaped_length >= String::kMaxLength - current_index_) return false;
+  const int required_length = static_cast<int>(escaped_length);
+  if (!CurrentPartCanFit(required_length)) {
+    ResizePart(std::max(part_length_ * kPartLengthGrowthFactor,
+                        current_index_ + required_length + 1));
+  }
+  DCHECK(CurrentPartCanFit(required_length));
+  return true;
+}
+
 template <typename SrcChar, typename DestChar, bool raw_json>
 bool JsonStringifier::SerializeString_(Tagged<String> string,
                                        const DisallowGarbageCollection& no_gc) {
@@ -1492,7 +1597,8 @@ bool JsonStringifier::SerializeString_(Tagged<String> string,
   // We might be able to fit the whole escaped string in the current string
   // part, or we might need to allocate.
   base::Vector<const SrcChar> vector = string->GetCharVector<SrcChar>(no_gc);
-  if V8_LIKELY (EscapedLengthIfCurrentPartFits(length)) {
+  if (V8_LIKELY(EscapedLengthIfCurrentPartFits(length)) ||
+      TryReserveEscapedLength<SrcChar, raw_json>(vector)) {
     NoExtendBuilder<DestChar> no_extend(
         reinterpret_cast<DestChar*>(part_ptr_) + current_index_,
         &current_index_);
@@ -1504,6 +1610,10 @@ bool JsonStringifier::SerializeString_(Tagged<String> string,
             String::IsOneByteRepresentationUnderneath(string)));
     int prev_escaped_offset = -1;
     for (int i = 0; i < vector.length(); i++) {
+      if constexpr (!raw_json) {
+        i = FindJsonEscapeCandidate(vector, i);
+        if (i == vector.length()) break;
+      }
       SrcChar c = vector.at(i);
       if (raw_json || DoNotEscape(c)) {
         continue;
@@ -1692,7 +1802,12 @@ void JsonStringifier::Extend() {
     overflowed_ = true;
     return;
   }
-  part_length_ *= kPartLengthGrowthFactor;
+  ResizePart(part_length_ * kPartLengthGrowthFactor);
+}
+
+void JsonStringifier::ResizePart(int new_length) {
+  DCHECK_GT(new_length, part_length_);
+  part_length_ = new_length;
   if (encoding_ == String::ONE_BYTE_ENCODING) {
     uint8_t* tmp_ptr = new uint8_t[part_length_];
     memcpy(tmp_ptr, one_byte_ptr_, current_index_);
@@ -92,6 +92,9 @@ namespace internal {
      0, 1, 2)                                                                  \
   /* Ticks observed in a single Turbofan compilation, in 1K. */                \
   HR(turbofan_ticks, V8.TurboFan1KTicks, 0, 100000, 200)                       \
+  /* Concurrent Turbofan input queue length, sampled on enqueue. */            \
+  HR(turbofan_optimize_queue_length, V8.TurboFanOptimizeQueueLength, 0, 64,    \
+     65)                                                                       \
   /* Backtracks observed in a single regexp interpreter execution. */          \
   /* The maximum of 100M backtracks takes roughly 2 seconds on my machine. */  \
   HR(regexp_backtracks, V8.RegExpBacktracks, 1, 100000000, 50)                 \
@@ -257,6 +260,8 @@ namespace internal {
      MICROSECOND)                                                              \
   HT(turbofan_optimize_non_concurrent_total_time,                              \
      V8.TurboFanOptimizeNonConcurrentTotalTime, 10000000, MICROSECOND)         \
+  HT(turbofan_optimize_queue_latency, V8.TurboFanOptimizeQueueLatency,         \
+     10000000, MICROSECOND)                                                    \
   HT(turbofan_optimize_concurrent_total_time,                                  \
      V8.TurboFanOptimizeConcurrentTotalTime, 10000000, MICROSECOND)            \
   HT(turbofan_osr_prepare, V8.TurboFanOptimizeForOnStackReplacementPrepare,    \
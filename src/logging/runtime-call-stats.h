@@ -179,6 +179,8 @@ class RuntimeCallTimer final {
   V(Isolate_DateTimeConfigurationChangeNotification)       \
   V(Isolate_LocaleConfigurationChangeNotification)         \
   V(JSON_Parse)                                            \
+  V(JSON_StreamingParser_Finish)                           \
+  V(JSON_StreamingParser_Write)                            \
   V(JSON_Stringify)                                        \
   V(Map_AsArray)                                           \
   V(Map_Clear)                                             \
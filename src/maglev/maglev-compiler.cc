@@ -149,6 +149,26 @@ bool MaglevCompiler::Compile(LocalIsolate* local_isolate,
     processor.ProcessGraph(graph);
   }
 
+  if (V8_UNLIKELY(v8_flags.maglev_escape_analysis_stats)) {
+    int elided = 0;
+    int escaped = 0;
+    int elided_bytes = 0;
+    for (const auto& it : graph->allocations_escape_map()) {
+      InlinedAllocation* alloc = it.first;
+      if (alloc->HasBeenElided()) {
+        elided++;
+        elided_bytes += alloc->size();
+      } else {
+        escaped++;
+      }
+    }
+    UnparkedScopeIfOnBackground unparked_scope(local_isolate->heap());
+    std::cout << "Maglev escape analysis for "
+              << Brief(*compilation_info->toplevel_function())
+              << ": elided=" << elided << " escaped=" << escaped
+              << " elided_bytes=" << elided_bytes << std::endl;
+  }
+
   if (v8_flags.print_maglev_graphs) {
     UnparkedScopeIfOnBackground unparked_scope(local_isolate->heap());
     std::cout << "After use marking" << std::endl;
@@ -196,6 +216,22 @@ bool MaglevCompiler::Compile(LocalIsolate* local_isolate,
       std::cout << "After register allocation" << std::endl;
       PrintGraph(std::cout, compilation_info, graph);
     }
+
+    if (V8_UNLIKELY(v8_flags.maglev_regalloc_stats)) {
+      UnparkedScopeIfOnBackground unparked_scope(local_isolate->heap());
+      const StraightForwardRegisterAllocator::Stats& stats =
+          allocator.stats();
+      std::cout << "Maglev register allocation for "
+                << Brief(*compilation_info->toplevel_function()) << ": mode="
+                << (allocator.is_loop_aware() ? "loop-aware" : "single-pass")
+                << " spills=" << stats.spills
+                << " reloads=" << stats.reloads
+                << " constant_moves=" << stats.constant_moves
+                << " loop_splits=" << stats.loop_splits
+                << " tagged_slots=" << graph->tagged_stack_slots()
+                << " untagged_slots=" << graph->untagged_stack_slots()
+                << std::endl;
+    }
   }
 
   {
@@ -9244,9 +9244,14 @@ ReduceResult MaglevGraphBuilder::ReduceCallForApiFunction(
     CHECK_NOT_NULL(receiver);
   }
 
+  // Inlined API calls are not supported by the Maglev->Turboshaft
+  // translation.
+  const bool inline_api_calls =
+      v8_flags.maglev_inline_api_calls &&
+      !compilation_unit()->info()->for_turboshaft_frontend();
   CallKnownApiFunction::Mode mode =
       broker()->dependencies()->DependOnNoProfilingProtector()
-          ? (v8_flags.maglev_inline_api_calls
+          ? (inline_api_calls
                  ? CallKnownApiFunction::kNoProfilingInlined
                  : CallKnownApiFunction::kNoProfiling)
           : CallKnownApiFunction::kGeneric;
@@ -9874,12 +9879,113 @@ ReduceResult MaglevGraphBuilder::ReduceCall(
         create_closure->feedback_cell().feedback_vector(broker()), args,
         feedback_source);
     RETURN_IF_DONE(result);
+  } else if (Phi* target_phi = target_node->TryCast<Phi>()) {
+    ReduceResult result =
+        TryReduceCallForPolymorphicTarget(target_phi, args, feedback_source);
+    RETURN_IF_DONE(result);
   }
 
   // On fallthrough, create a generic call.
   return BuildGenericCall(target_node, Call::TargetType::kAny, args);
 }
 
+ReduceResult MaglevGraphBuilder::TryReduceCallForPolymorphicTarget(
+    Phi* target_phi, CallArguments& args,
+    const compiler::FeedbackSource& feedback_source) {
+  if (!v8_flags.maglev_polymorphic_inlining) return ReduceResult::Fail();
+  if (args.mode() != CallArguments::kDefault) return ReduceResult::Fail();
+  // Loop phis don't have their back edge input yet.
+  if (target_phi->is_loop_phi() || target_phi->is_exception_phi()) {
+    return ReduceResult::Fail();
+  }
+
+  // Collect the distinct functions that flow into the phi. If any input isn't
+  // a known function, we can't build an exhaustive dispatch.
+  SmallZoneVector<compiler::JSFunctionRef, 4> targets(zone());
+  int cumulative_bytecode_size = 0;
+  for (int i = 0; i < target_phi->input_count(); i++) {
+    compiler::OptionalHeapObjectRef constant =
+        TryGetConstant(target_phi->input(i).node());
+    if (!constant.has_value() || !constant->IsJSFunction()) {
+      return ReduceResult::Fail();
+    }
+    compiler::JSFunctionRef function = constant->AsJSFunction();
+    if (std::any_of(targets.begin(), targets.end(),
+                    [&](compiler::JSFunctionRef target) {
+                      return target.equals(function);
+                    })) {
+      continue;
+    }
+    if (static_cast<int>(targets.size()) >=
+        v8_flags.max_maglev_polymorphic_inlining_targets) {
+      return ReduceResult::Fail();
+    }
+    compiler::SharedFunctionInfoRef shared = function.shared(broker());
+    if (shared.HasBytecodeArray()) {
+      cumulative_bytecode_size += shared.GetBytecodeArray(broker()).length();
+    }
+    if (cumulative_bytecode_size >
+        v8_flags.max_maglev_polymorphic_inlined_bytecode_size) {
+      return ReduceResult::Fail();
+    }
+    targets.push_back(function);
+  }
+  DCHECK(!targets.empty());
+
+  TRACE_INLINING("  polymorphic call with " << targets.size() << " targets");
+
+  // Since the phi can only produce one of {targets}, the dispatch is
+  // exhaustive and the last target doesn't need a check.
+  const int target_count = static_cast<int>(targets.size());
+  MaglevSubGraphBuilder sub_graph(this, 1);
+  MaglevSubGraphBuilder::Variable ret_val(0);
+  MaglevSubGraphBuilder::Label done(
+      &sub_graph, target_count,
+      std::initializer_list<MaglevSubGraphBuilder::Variable*>{&ret_val});
+  int inlined_count = 0;
+  for (int i = 0; i < target_count; i++) {
+    std::optional<MaglevSubGraphBuilder::Label> check_next_target;
+    if (i < target_count - 1) {
+      check_next_target.emplace(&sub_graph, 1);
+      sub_graph.GotoIfFalse<BranchIfReferenceEqual>(
+          &*check_next_target, {target_phi, GetConstant(targets[i])});
+    }
+    // Reductions may modify the arguments, so give each arm its own copy.
+    CallArguments target_args = args;
+    size_t inlined_functions = graph()->inlined_functions().size();
+    ReduceResult result =
+        ReduceCallForConstant(targets[i], target_args, feedback_source);
+    if (graph()->inlined_functions().size() > inlined_functions) {
+      inlined_count++;
+    }
+    if (result.IsFail()) {
+      result = BuildGenericCall(GetConstant(targets[i]),
+                                Call::TargetType::kJSFunction, target_args);
+    }
+    if (result.IsDoneWithAbort()) {
+      DCHECK_NULL(current_block_);
+      sub_graph.ReducePredecessorCount(&done);
+    } else {
+      sub_graph.set(ret_val, result.value());
+      sub_graph.Goto(&done);
+    }
+    if (check_next_target.has_value()) {
+      sub_graph.Bind(&*check_next_target);
+    }
+  }
+  if (V8_UNLIKELY(v8_flags.trace_maglev_polymorphic_inlining)) {
+    StdoutStream{} << "[maglev inlined " << inlined_count << " of "
+                   << target_count << " polymorphic call targets in "
+                   << compilation_unit_->shared_function_info()
+                          .object()
+                          ->DebugNameCStr()
+                          .get()
+                   << "]" << std::endl;
+  }
+  RETURN_IF_ABORT(sub_graph.TrimPredecessorsAndBind(&done));
+  return sub_graph.get(ret_val);
+}
+
 void MaglevGraphBuilder::BuildCallFromRegisterList(
     ConvertReceiverMode receiver_mode) {
   ValueNode* target = LoadRegister(0);
@@ -1999,6 +1999,9 @@ class MaglevGraphBuilder {
   ReduceResult ReduceCallForTarget(
       ValueNode* target_node, compiler::JSFunctionRef target,
       CallArguments& args, const compiler::FeedbackSource& feedback_source);
+  ReduceResult TryReduceCallForPolymorphicTarget(
+      Phi* target_phi, CallArguments& args,
+      const compiler::FeedbackSource& feedback_source);
   ReduceResult ReduceCallForNewClosure(
       ValueNode* target_node, ValueNode* target_context,
       compiler::SharedFunctionInfoRef shared,
@@ -198,11 +198,22 @@ bool IsDeadNodeToSkip(Node* node) {
          !value->properties().is_required_when_unused();
 }
 
+bool UseLoopAwareMode(Graph* graph) {
+  if (!v8_flags.maglev_loop_aware_regalloc) return false;
+  // Node ids are assigned in block order, so the last control node has the
+  // largest one.
+  NodeIdT size = graph->last_block()->control_node()->id();
+  return static_cast<int>(size) <=
+         v8_flags.maglev_loop_aware_regalloc_max_size;
+}
+
 }  // namespace
 
 StraightForwardRegisterAllocator::StraightForwardRegisterAllocator(
     MaglevCompilationInfo* compilation_info, Graph* graph)
-    : compilation_info_(compilation_info), graph_(graph) {
+    : compilation_info_(compilation_info),
+      graph_(graph),
+      loop_aware_(UseLoopAwareMode(graph)) {
   ComputePostDominatingHoles();
   AllocateRegisters();
   uint32_t tagged_stack_slots = tagged_.top;
@@ -1170,6 +1181,7 @@ void StraightForwardRegisterAllocator::AddMoveBeforeCurrentNode(
     }
     gap_move =
         Node::New<ConstantGapMove>(compilation_info_->zone(), 0, node, target);
+    stats_.constant_moves++;
   } else {
     if (v8_flags.trace_maglev_regalloc) {
       printing_visitor_->os() << "  gap move: " << target << " ← "
@@ -1179,6 +1191,7 @@ void StraightForwardRegisterAllocator::AddMoveBeforeCurrentNode(
     gap_move =
         Node::New<GapMove>(compilation_info_->zone(), 0,
                            compiler::AllocatedOperand::cast(source), target);
+    if (source.IsAnyStackSlot()) stats_.reloads++;
   }
   gap_move->InitTemporaries();
   if (compilation_info_->has_graph_labeller()) {
@@ -1673,6 +1686,18 @@ void StraightForwardRegisterAllocator::AllocateSpillSlot(ValueNode* node) {
   }
   node->Spill(compiler::AllocatedOperand(compiler::AllocatedOperand::STACK_SLOT,
                                          representation, free_slot));
+  stats_.spills++;
+}
+
+// static
+int StraightForwardRegisterAllocator::EvictionDistance(int next_use,
+                                                       int current_id,
+                                                       bool is_loadable) {
+  // Values that are constants or already spilled can be dropped without a
+  // spill store, so they are worth evicting even if they are needed somewhat
+  // sooner than other values.
+  int distance = next_use - current_id;
+  return is_loadable ? distance * 2 : distance;
 }
 
 template <typename RegisterT>
@@ -1683,6 +1708,8 @@ RegisterT StraightForwardRegisterAllocator::PickRegisterToFree(
     printing_visitor_->os() << "  need to free a register... ";
   }
   int furthest_use = 0;
+  int best_distance = kMinInt;
+  const int current_id = current_node_ ? current_node_->id() : 0;
   RegisterT best = RegisterT::no_reg();
   for (RegisterT reg : (registers.used() - reserved)) {
     ValueNode* value = registers.GetValue(reg);
@@ -1695,7 +1722,14 @@ RegisterT StraightForwardRegisterAllocator::PickRegisterToFree(
       break;
     }
     int use = value->current_next_use();
-    if (use > furthest_use) {
+    if (v8_flags.maglev_cost_aware_register_eviction) {
+      int distance = EvictionDistance(use, current_id, value->is_loadable());
+      if (distance > best_distance) {
+        best_distance = distance;
+        furthest_use = use;
+        best = reg;
+      }
+    } else if (use > furthest_use) {
       furthest_use = use;
       best = reg;
     }
@@ -2140,7 +2174,6 @@ void StraightForwardRegisterAllocator::HoistLoopReloads(
     BasicBlock* target, RegisterFrameState<RegisterT>& registers) {
   for (ValueNode* node : target->reload_hints()) {
     DCHECK(general_registers_.blocked().is_empty());
-    if (registers.free().is_empty()) break;
     if (node->has_register()) continue;
     // The value is in a liveness hole, don't try to reload it.
     if (!node->is_loadable()) continue;
@@ -2149,6 +2182,10 @@ void StraightForwardRegisterAllocator::HoistLoopReloads(
          std::is_same_v<RegisterT, DoubleRegister>)) {
       continue;
     }
+    if (registers.free().is_empty() &&
+        !(loop_aware_ && SplitLiveRangeAtLoopEntry(target, registers))) {
+      break;
+    }
     RegisterT target_reg = node->GetRegisterHint<RegisterT>();
     if (!registers.free().has(target_reg)) {
       target_reg = registers.free().first();
@@ -2168,6 +2205,7 @@ void StraightForwardRegisterAllocator::HoistLoopReloads(
 void StraightForwardRegisterAllocator::HoistLoopSpills(BasicBlock* target) {
   for (ValueNode* node : target->spill_hints()) {
     if (!node->has_register()) continue;
+    stats_.loop_splits++;
     // Do not move to a different register, the goal is to keep the value
     // spilled on the back-edge.
     const bool kForceSpill = true;
@@ -2183,6 +2221,37 @@ void StraightForwardRegisterAllocator::HoistLoopSpills(BasicBlock* target) {
   }
 }
 
+// With --maglev-loop-aware-regalloc, frees a register for a reload hint of the
+// loop {target} by splitting the live range of a value that the loop does not
+// use at all: it is spilled before the loop and reloaded at its next use after
+// the loop, instead of occupying a register throughout it. Returns false if
+// there is no such value.
+template <typename RegisterT>
+bool StraightForwardRegisterAllocator::SplitLiveRangeAtLoopEntry(
+    BasicBlock* target, RegisterFrameState<RegisterT>& registers) {
+  DCHECK(loop_aware_);
+  DCHECK(target->is_loop());
+  // Uses inside the loop, including deopt uses, are extended to its JumpLoop,
+  // so any value with a later next use is not used in the loop.
+  NodeIdT furthest_use = target->backedge_predecessor()->control_node()->id();
+  RegisterT best = RegisterT::no_reg();
+  for (RegisterT reg : registers.used()) {
+    NodeIdT use = registers.GetValue(reg)->current_next_use();
+    if (use > furthest_use) {
+      furthest_use = use;
+      best = reg;
+    }
+  }
+  if (!best.is_valid()) return false;
+  if (v8_flags.trace_maglev_regalloc) {
+    printing_visitor_->os() << "  splitting " << best << " at loop entry\n";
+  }
+  const bool kForceSpill = true;
+  DropRegisterValueAtEnd(best, kForceSpill);
+  stats_.loop_splits++;
+  return true;
+}
+
 void StraightForwardRegisterAllocator::InitializeBranchTargetRegisterValues(
     ControlNode* source, BasicBlock* target) {
   MergePointRegisterState& target_state = target->state()->register_state();
@@ -2196,9 +2265,12 @@ void StraightForwardRegisterAllocator::InitializeBranchTargetRegisterValues(
     }
     state = {node, initialized_node};
   };
+  // In the loop-aware mode, spills are hoisted first, so that the registers
+  // they free can keep reload hints in registers across the back-edge.
+  if (loop_aware_) HoistLoopSpills(target);
   HoistLoopReloads(target, general_registers_);
   HoistLoopReloads(target, double_registers_);
-  HoistLoopSpills(target);
+  if (!loop_aware_) HoistLoopSpills(target);
   ForEachMergePointRegisterState(target_state, init);
 }
 
@@ -144,6 +144,31 @@ class StraightForwardRegisterAllocator {
                                    Graph* graph);
   ~StraightForwardRegisterAllocator();
 
+  // Counts of the moves the allocator had to insert, for
+  // --maglev-regalloc-stats.
+  struct Stats {
+    // Values assigned a stack slot, i.e. stored to the stack once.
+    int spills = 0;
+    // Gap moves from a stack slot into a register.
+    int reloads = 0;
+    // Gap moves materializing a constant into a register.
+    int constant_moves = 0;
+    // Values dropped from a register on entry to a loop, because they are not
+    // needed in a register across its back-edge.
+    int loop_splits = 0;
+  };
+  const Stats& stats() const { return stats_; }
+
+  // Whether the function was small enough to be allocated in the loop-aware
+  // mode of --maglev-loop-aware-regalloc.
+  bool is_loop_aware() const { return loop_aware_; }
+
+  // With --maglev-cost-aware-register-eviction, the register to free is the
+  // one whose value has the largest eviction distance: the distance from
+  // {current_id} to its {next_use}, doubled for values that need no spill
+  // store when dropped.
+  static int EvictionDistance(int next_use, int current_id, bool is_loadable);
+
  private:
   RegisterFrameState<Register> general_registers_;
   RegisterFrameState<DoubleRegister> double_registers_;
@@ -273,6 +298,9 @@ class StraightForwardRegisterAllocator {
   void HoistLoopReloads(BasicBlock* target,
                         RegisterFrameState<RegisterT>& registers);
   void HoistLoopSpills(BasicBlock* target);
+  template <typename RegisterT>
+  bool SplitLiveRangeAtLoopEntry(BasicBlock* target,
+                                 RegisterFrameState<RegisterT>& registers);
   void InitializeBranchTargetRegisterValues(ControlNode* source,
                                             BasicBlock* target);
   void InitializeEmptyBlockRegisterValues(ControlNode* source,
@@ -294,6 +322,8 @@ class StraightForwardRegisterAllocator {
   NodeIterator node_it_;
   // The current node, whether a Node in the body or the ControlNode.
   NodeBase* current_node_;
+  const bool loop_aware_;
+  Stats stats_;
 };
 
 }  // namespace maglev
@@ -61,6 +61,11 @@ size_t GetReservationSize(bool has_guard_regions, size_t byte_capacity,
     DCHECK_LE(byte_capacity, size_t{4} * GB);
     return kFullGuardSize32;
   }
+  if (has_guard_regions) {
+    // Memory64 code only checks the index of accesses with small offsets, see
+    // {WasmMemory::trap_handler_index_limit}.
+    return byte_capacity + wasm::memory64_guard_region_size();
+  }
 #else
   DCHECK(!has_guard_regions);
 #endif
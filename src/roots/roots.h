@@ -354,6 +354,7 @@ class RootVisitor;
   V(FixedArray, string_split_cache, StringSplitCache)                          \
   V(FixedArray, regexp_multiple_cache, RegExpMultipleCache)                    \
   V(FixedArray, regexp_match_global_atom_cache, RegExpMatchGlobalAtomCache)    \
+  V(FixedArray, json_object_map_cache, JsonObjectMapCache)                     \
   /* Indirection lists for isolate-independent builtins */                     \
   V(FixedArray, builtins_constants_table, BuiltinsConstantsTable)              \
   /* Internal SharedFunctionInfos */                                           \
@@ -451,14 +451,13 @@ void FindTwoByteStringIndices(const base::Vector<const base::uc16> subject,
                               base::uc16 pattern, std::vector<int>* indices,
                               unsigned int limit) {
   DCHECK_LT(0, limit);
-  const base::uc16* subject_start = subject.begin();
-  const base::uc16* subject_end = subject_start + subject.length();
-  for (const base::uc16* pos = subject_start; pos < subject_end && limit > 0;
-       pos++) {
-    if (*pos == pattern) {
-      indices->push_back(static_cast<int>(pos - subject_start));
-      limit--;
-    }
+  int index = 0;
+  while (limit > 0) {
+    index = FindTwoByteCharacter(subject, pattern, index);
+    if (index < 0) return;
+    indices->push_back(index);
+    index++;
+    limit--;
   }
 }
 
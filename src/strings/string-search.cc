@@ -0,0 +1,82 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/strings/string-search.h"
+
+// Only the statically selected (baseline) target is used, so no dynamic
+// dispatch is needed.
+#include "hwy/highway.h"
+
+namespace v8 {
+namespace internal {
+
+namespace {
+
+namespace hw = hwy::HWY_NAMESPACE;
+
+template <typename Char>
+int FindFirstAndLastCharacterImpl(base::Vector<const Char> subject,
+                                  Char first_char, Char last_char,
+                                  int last_offset, int index) {
+  DCHECK_GT(last_offset, 0);
+  const int max_n = subject.length() - last_offset;
+  const hw::ScalableTag<Char> d;
+  const int lanes = static_cast<int>(hw::Lanes(d));
+  const auto first = hw::Set(d, first_char);
+  const auto last = hw::Set(d, last_char);
+  const Char* chars = subject.begin();
+  int i = index;
+  for (; i + lanes <= max_n; i += lanes) {
+    const auto candidates =
+        hw::And(hw::Eq(hw::LoadU(d, chars + i), first),
+                hw::Eq(hw::LoadU(d, chars + i + last_offset), last));
+    if (!hw::AllFalse(d, candidates)) {
+      return i + static_cast<int>(hw::FindKnownFirstTrue(d, candidates));
+    }
+  }
+  for (; i < max_n; i++) {
+    if (chars[i] == first_char && chars[i + last_offset] == last_char) {
+      return i;
+    }
+  }
+  return -1;
+}
+
+}  // namespace
+
+int FindTwoByteCharacter(base::Vector<const base::uc16> subject, base::uc16 c,
+                         int index) {
+  const hw::ScalableTag<base::uc16> d;
+  const int lanes = static_cast<int>(hw::Lanes(d));
+  const auto search = hw::Set(d, c);
+  const int length = subject.length();
+  int i = index;
+  for (; i + lanes <= length; i += lanes) {
+    const auto matches = hw::Eq(hw::LoadU(d, subject.begin() + i), search);
+    if (!hw::AllFalse(d, matches)) {
+      return i + static_cast<int>(hw::FindKnownFirstTrue(d, matches));
+    }
+  }
+  for (; i < length; i++) {
+    if (subject[i] == c) return i;
+  }
+  return -1;
+}
+
+int FindFirstAndLastCharacter(base::Vector<const uint8_t> subject,
+                              uint8_t first_char, uint8_t last_char,
+                              int last_offset, int index) {
+  return FindFirstAndLastCharacterImpl(subject, first_char, last_char,
+                                       last_offset, index);
+}
+
+int FindFirstAndLastCharacter(base::Vector<const base::uc16> subject,
+                              base::uc16 first_char, base::uc16 last_char,
+                              int last_offset, int index) {
+  return FindFirstAndLastCharacterImpl(subject, first_char, last_char,
+                                       last_offset, index);
+}
+
+}  // namespace internal
+}  // namespace v8
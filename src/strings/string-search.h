@@ -182,50 +182,62 @@ class StringSearch : private StringSearchBase {
   int start_;
 };
 
-template <typename T, typename U>
-inline T AlignDown(T value, U alignment) {
-  return reinterpret_cast<T>(
-      (reinterpret_cast<uintptr_t>(value) & ~(alignment - 1)));
-}
-
-inline uint8_t GetHighestValueByte(base::uc16 character) {
-  return std::max(static_cast<uint8_t>(character & 0xFF),
-                  static_cast<uint8_t>(character >> 8));
-}
-
-inline uint8_t GetHighestValueByte(uint8_t character) { return character; }
+// Returns the index of the first occurrence of {c} in {subject} at or after
+// {index}, or -1. memchr only finds bytes, so in two-byte subjects it would
+// stop at every character that merely contains a byte of {c}.
+V8_EXPORT_PRIVATE int FindTwoByteCharacter(
+    base::Vector<const base::uc16> subject, base::uc16 c, int index);
+
+// Returns the first index at or after {index} at which {subject} contains
+// {first_char}, and {last_char} {last_offset} characters later, or -1. Both
+// are compared a vector of positions at a time.
+V8_EXPORT_PRIVATE int FindFirstAndLastCharacter(
+    base::Vector<const uint8_t> subject, uint8_t first_char,
+    uint8_t last_char, int last_offset, int index);
+V8_EXPORT_PRIVATE int FindFirstAndLastCharacter(
+    base::Vector<const base::uc16> subject, base::uc16 first_char,
+    base::uc16 last_char, int last_offset, int index);
 
 template <typename PatternChar, typename SubjectChar>
 inline int FindFirstCharacter(base::Vector<const PatternChar> pattern,
                               base::Vector<const SubjectChar> subject,
                               int index) {
-  const PatternChar pattern_first_char = pattern[0];
   const int max_n = (subject.length() - pattern.length() + 1);
-
-  if (sizeof(SubjectChar) == 2 && pattern_first_char == 0) {
-    // Special-case looking for the 0 char in other than one-byte strings.
-    // memchr mostly fails in this case due to every other byte being 0 in text
-    // that is mostly ascii characters.
-    for (int i = index; i < max_n; ++i) {
-      if (subject[i] == 0) return i;
-    }
-    return -1;
-  }
-  const uint8_t search_byte = GetHighestValueByte(pattern_first_char);
-  const SubjectChar search_char = static_cast<SubjectChar>(pattern_first_char);
-  int pos = index;
-  do {
-    DCHECK_GE(max_n - pos, 0);
+  if (index >= max_n) return -1;
+  // The pattern only reaches here if its characters fit the subject.
+  const SubjectChar search_char = static_cast<SubjectChar>(pattern[0]);
+  DCHECK_EQ(search_char, pattern[0]);
+
+  if constexpr (sizeof(SubjectChar) == 2) {
+    return FindTwoByteCharacter(subject.SubVector(0, max_n), search_char,
+                                index);
+  } else {
     const SubjectChar* char_pos = reinterpret_cast<const SubjectChar*>(
-        memchr(subject.begin() + pos, search_byte,
-               (max_n - pos) * sizeof(SubjectChar)));
+        memchr(subject.begin() + index, search_char, max_n - index));
     if (char_pos == nullptr) return -1;
-    char_pos = AlignDown(char_pos, sizeof(SubjectChar));
-    pos = static_cast<int>(char_pos - subject.begin());
-    if (subject[pos] == search_char) return pos;
-  } while (++pos < max_n);
+    return static_cast<int>(char_pos - subject.begin());
+  }
+}
 
-  return -1;
+// Returns the first index at or after {index} at which {subject} matches both
+// the first and the last character of {pattern}, or -1. Checking the last
+// character along with the first rejects most false candidates of a first
+// character scan, a vector of positions at a time.
+template <typename PatternChar, typename SubjectChar>
+inline int FindFirstAndLastCharacter(base::Vector<const PatternChar> pattern,
+                                     base::Vector<const SubjectChar> subject,
+                                     int index) {
+  DCHECK_GT(pattern.length(), 1);
+  const int last_offset = pattern.length() - 1;
+  // One-byte patterns are compared in the width of two-byte subjects, and
+  // two-byte patterns only reach here if their characters fit one-byte
+  // subjects.
+  const SubjectChar first_char = static_cast<SubjectChar>(pattern[0]);
+  const SubjectChar last_char = static_cast<SubjectChar>(pattern[last_offset]);
+  DCHECK_EQ(first_char, pattern[0]);
+  DCHECK_EQ(last_char, pattern[last_offset]);
+  return FindFirstAndLastCharacter(subject, first_char, last_char, last_offset,
+                                   index);
 }
 
 //---------------------------------------------------------------------
@@ -275,16 +287,16 @@ int StringSearch<PatternChar, SubjectChar>::LinearSearch(
   int i = index;
   int n = subject.length() - pattern_length;
   while (i <= n) {
-    i = FindFirstCharacter(pattern, subject, i);
+    i = FindFirstAndLastCharacter(pattern, subject, i);
     if (i == -1) return -1;
     DCHECK_LE(i, n);
-    i++;
-    // Loop extracted to separate function to allow using return to do
-    // a deeper break.
-    if (CharCompare(pattern.begin() + 1, subject.begin() + i,
-                    pattern_length - 1)) {
-      return i - 1;
+    // The first and last characters match, compare the ones in between.
+    if (pattern_length == 2 ||
+        CharCompare(pattern.begin() + 1, subject.begin() + i + 1,
+                    pattern_length - 2)) {
+      return i;
     }
+    i++;
   }
   return -1;
 }
@@ -505,12 +517,12 @@ int StringSearch<PatternChar, SubjectChar>::InitialSearch(
   // algorithm.
   int badness = -10 - (pattern_length << 2);
 
-  // We know our pattern is at least 2 characters, we cache the first so
-  // the common case of the first character not matching is faster.
+  // We know our pattern is at least 2 characters, we scan for its first and
+  // last character so the common case of a mismatch is faster.
   for (int i = index, n = subject.length() - pattern_length; i <= n; i++) {
     badness++;
     if (badness <= 0) {
-      i = FindFirstCharacter(pattern, subject, i);
+      i = FindFirstAndLastCharacter(pattern, subject, i);
       if (i == -1) return -1;
       DCHECK_LE(i, n);
       int j = 1;
@@ -147,6 +147,27 @@ void InitMergeRegion(LiftoffAssembler::CacheState* target_state,
   }
 }
 
+// Returns whether each value in the merge region [source, source+count] is in
+// a register or a constant, and can get a register of its own in
+// {target_state} without using any of {used_regs}. In that case the target
+// region will not contain any stack slots.
+bool MergeRegionFitsInRegisters(
+    const LiftoffAssembler::CacheState& target_state, const VarState* source,
+    uint32_t count, LiftoffRegList used_regs) {
+  // Register pairs would need a more precise accounting; just give up.
+  if (kNeedI64RegPair || kNeedS128RegPair) return false;
+  LiftoffRegList blocked_regs = used_regs | target_state.used_registers;
+  int free_gp_regs = kGpCacheRegList.MaskOut(blocked_regs).GetNumRegsSet();
+  int free_fp_regs = kFpCacheRegList.MaskOut(blocked_regs).GetNumRegsSet();
+  for (const VarState& value : base::VectorOf(source, count)) {
+    if (value.is_stack()) return false;
+    int& free_regs =
+        reg_class_for(value.kind()) == kGpReg ? free_gp_regs : free_fp_regs;
+    if (--free_regs < 0) return false;
+  }
+  return true;
+}
+
 }  // namespace
 
 LiftoffAssembler::CacheState LiftoffAssembler::MergeIntoNewState(
@@ -203,17 +224,21 @@ LiftoffAssembler::CacheState LiftoffAssembler::MergeIntoNewState(
   for (auto& src : base::VectorOf(locals_source, num_locals)) {
     if (src.is_reg()) used_regs.set(src.reg());
   }
+  LiftoffRegList merge_regs;
+  for (auto& src : base::VectorOf(merge_source, arity)) {
+    if (src.is_reg()) merge_regs.set(src.reg());
+  }
   // If there is more than one operand in the merge region, a stack-to-stack
   // move can interfere with a register reload, which would not be handled
   // correctly by the ParallelMove. To avoid this, spill all registers in
-  // this region.
+  // this region, unless every operand gets a register of its own (then there
+  // are no stack slots in this region which could be moved).
   MergeAllowRegisters allow_registers =
-      arity <= 1 ? kRegistersAllowed : kRegistersNotAllowed;
-  if (allow_registers) {
-    for (auto& src : base::VectorOf(merge_source, arity)) {
-      if (src.is_reg()) used_regs.set(src.reg());
-    }
-  }
+      arity <= 1 || MergeRegionFitsInRegisters(target, merge_source, arity,
+                                               used_regs | merge_regs)
+          ? kRegistersAllowed
+          : kRegistersNotAllowed;
+  if (allow_registers) used_regs |= merge_regs;
 
   ParallelMove parallel_move{this};
 
@@ -7,6 +7,7 @@
 #include <optional>
 
 #include "src/base/enum-set.h"
+#include "src/base/overflowing-math.h"
 #include "src/codegen/assembler-inl.h"
 // TODO(clemensb): Remove dependences on compiler stuff.
 #include "src/codegen/external-reference.h"
@@ -2329,6 +2330,40 @@ class LiftoffCompiler {
     }
   }
 
+  // Like {EmitBinOpImm}, but computes the result at compile time if both
+  // operands are constants. For commutative operations, a constant LHS is
+  // swapped into the immediate.
+  template <ValueKind kind, bool commutative, typename FoldFn, typename EmitFn,
+            typename EmitFnImm>
+  void EmitFoldableBinOpImm(FoldFn fold, EmitFn fn, EmitFnImm fnImm) {
+    static_assert(kind == kI32 || kind == kI64);
+    using ctype = std::conditional_t<kind == kI32, int32_t, int64_t>;
+    auto& stack_state = __ cache_state()->stack_state;
+    VarState& rhs_slot = stack_state.end()[-1];
+    VarState& lhs_slot = stack_state.end()[-2];
+    if (lhs_slot.is_const()) {
+      if (rhs_slot.is_const()) {
+        ctype result =
+            fold(ctype{lhs_slot.i32_const()}, ctype{rhs_slot.i32_const()});
+        // Constants in the cache state are limited to 32 bits.
+        if (kind == kI32 || is_int32(result)) {
+          stack_state.pop_back(2);
+          __ PushConstant(kind, static_cast<int32_t>(result));
+          return;
+        }
+      } else if (commutative && rhs_slot.is_reg()) {
+        // Register values do not depend on their stack position, so only the
+        // spill offsets need to stay in place.
+        int lhs_offset = lhs_slot.offset();
+        int rhs_offset = rhs_slot.offset();
+        std::swap(lhs_slot, rhs_slot);
+        lhs_slot.set_offset(lhs_offset);
+        rhs_slot.set_offset(rhs_offset);
+      }
+    }
+    EmitBinOpImm<kind, kind>(fn, fnImm);
+  }
+
   template <ValueKind src_kind, ValueKind result_kind,
             bool swap_lhs_rhs = false, ValueKind result_lane_kind = kVoid,
             typename EmitFn>
@@ -2413,21 +2448,31 @@ class LiftoffCompiler {
              const Value& rhs, Value* result) {
     switch (opcode) {
       case kExprI32Add:
-        return EmitBinOpImm<kI32, kI32>(&LiftoffAssembler::emit_i32_add,
-                                        &LiftoffAssembler::emit_i32_addi);
+        return EmitFoldableBinOpImm<kI32, true>(
+            base::AddWithWraparound<int32_t>, &LiftoffAssembler::emit_i32_add,
+            &LiftoffAssembler::emit_i32_addi);
       case kExprI32Sub:
-        return EmitBinOp<kI32, kI32>(&LiftoffAssembler::emit_i32_sub);
+        // Subtracting a constant is emitted as adding its negation.
+        return EmitFoldableBinOpImm<kI32, false>(
+            base::SubWithWraparound<int32_t>, &LiftoffAssembler::emit_i32_sub,
+            [this](LiftoffRegister dst, LiftoffRegister lhs, int32_t imm) {
+              __ emit_i32_addi(dst.gp(), lhs.gp(),
+                               base::NegateWithWraparound(imm));
+            });
       case kExprI32Mul:
         return EmitBinOp<kI32, kI32>(&LiftoffAssembler::emit_i32_mul);
       case kExprI32And:
-        return EmitBinOpImm<kI32, kI32>(&LiftoffAssembler::emit_i32_and,
-                                        &LiftoffAssembler::emit_i32_andi);
+        return EmitFoldableBinOpImm<kI32, true>(
+            [](int32_t lhs, int32_t rhs) { return lhs & rhs; },
+            &LiftoffAssembler::emit_i32_and, &LiftoffAssembler::emit_i32_andi);
       case kExprI32Ior:
-        return EmitBinOpImm<kI32, kI32>(&LiftoffAssembler::emit_i32_or,
-                                        &LiftoffAssembler::emit_i32_ori);
+        return EmitFoldableBinOpImm<kI32, true>(
+            [](int32_t lhs, int32_t rhs) { return lhs | rhs; },
+            &LiftoffAssembler::emit_i32_or, &LiftoffAssembler::emit_i32_ori);
       case kExprI32Xor:
-        return EmitBinOpImm<kI32, kI32>(&LiftoffAssembler::emit_i32_xor,
-                                        &LiftoffAssembler::emit_i32_xori);
+        return EmitFoldableBinOpImm<kI32, true>(
+            [](int32_t lhs, int32_t rhs) { return lhs ^ rhs; },
+            &LiftoffAssembler::emit_i32_xor, &LiftoffAssembler::emit_i32_xori);
       case kExprI32Eq:
         return EmitI32CmpOp<kExprI32Eq>(decoder);
       case kExprI32Ne:
@@ -2449,21 +2494,30 @@ class LiftoffCompiler {
       case kExprI32GeU:
         return EmitI32CmpOp<kExprI32GeU>(decoder);
       case kExprI64Add:
-        return EmitBinOpImm<kI64, kI64>(&LiftoffAssembler::emit_i64_add,
-                                        &LiftoffAssembler::emit_i64_addi);
+        return EmitFoldableBinOpImm<kI64, true>(
+            base::AddWithWraparound<int64_t>, &LiftoffAssembler::emit_i64_add,
+            &LiftoffAssembler::emit_i64_addi);
       case kExprI64Sub:
-        return EmitBinOp<kI64, kI64>(&LiftoffAssembler::emit_i64_sub);
+        // Subtracting a constant is emitted as adding its negation.
+        return EmitFoldableBinOpImm<kI64, false>(
+            base::SubWithWraparound<int64_t>, &LiftoffAssembler::emit_i64_sub,
+            [this](LiftoffRegister dst, LiftoffRegister lhs, int32_t imm) {
+              __ emit_i64_addi(dst, lhs, -int64_t{imm});
+            });
       case kExprI64Mul:
         return EmitBinOp<kI64, kI64>(&LiftoffAssembler::emit_i64_mul);
       case kExprI64And:
-        return EmitBinOpImm<kI64, kI64>(&LiftoffAssembler::emit_i64_and,
-                                        &LiftoffAssembler::emit_i64_andi);
+        return EmitFoldableBinOpImm<kI64, true>(
+            [](int64_t lhs, int64_t rhs) { return lhs & rhs; },
+            &LiftoffAssembler::emit_i64_and, &LiftoffAssembler::emit_i64_andi);
       case kExprI64Ior:
-        return EmitBinOpImm<kI64, kI64>(&LiftoffAssembler::emit_i64_or,
-                                        &LiftoffAssembler::emit_i64_ori);
+        return EmitFoldableBinOpImm<kI64, true>(
+            [](int64_t lhs, int64_t rhs) { return lhs | rhs; },
+            &LiftoffAssembler::emit_i64_or, &LiftoffAssembler::emit_i64_ori);
       case kExprI64Xor:
-        return EmitBinOpImm<kI64, kI64>(&LiftoffAssembler::emit_i64_xor,
-                                        &LiftoffAssembler::emit_i64_xori);
+        return EmitFoldableBinOpImm<kI64, true>(
+            [](int64_t lhs, int64_t rhs) { return lhs ^ rhs; },
+            &LiftoffAssembler::emit_i64_xor, &LiftoffAssembler::emit_i64_xori);
       case kExprI64Eq:
         return EmitBinOp<kI64, kI32>(
             BindFirst(&LiftoffAssembler::emit_i64_set_cond, kEqual));
@@ -2531,14 +2585,20 @@ class LiftoffCompiler {
         return EmitBinOp<kF64, kI32>(BindFirst(
             &LiftoffAssembler::emit_f64_set_cond, kUnsignedGreaterThanEqual));
       case kExprI32Shl:
-        return EmitBinOpImm<kI32, kI32>(&LiftoffAssembler::emit_i32_shl,
-                                        &LiftoffAssembler::emit_i32_shli);
+        return EmitFoldableBinOpImm<kI32, false>(
+            base::ShlWithWraparound<int32_t>, &LiftoffAssembler::emit_i32_shl,
+            &LiftoffAssembler::emit_i32_shli);
       case kExprI32ShrS:
-        return EmitBinOpImm<kI32, kI32>(&LiftoffAssembler::emit_i32_sar,
-                                        &LiftoffAssembler::emit_i32_sari);
+        return EmitFoldableBinOpImm<kI32, false>(
+            [](int32_t lhs, int32_t rhs) { return lhs >> (rhs & 31); },
+            &LiftoffAssembler::emit_i32_sar, &LiftoffAssembler::emit_i32_sari);
       case kExprI32ShrU:
-        return EmitBinOpImm<kI32, kI32>(&LiftoffAssembler::emit_i32_shr,
-                                        &LiftoffAssembler::emit_i32_shri);
+        return EmitFoldableBinOpImm<kI32, false>(
+            [](int32_t lhs, int32_t rhs) {
+              return static_cast<int32_t>(static_cast<uint32_t>(lhs) >>
+                                          (rhs & 31));
+            },
+            &LiftoffAssembler::emit_i32_shr, &LiftoffAssembler::emit_i32_shri);
       case kExprI32Rol:
         return EmitBitRotationCCall<kI32, ExternalReference::wasm_word32_rol>();
       case kExprI32Ror:
@@ -3404,11 +3464,12 @@ class LiftoffCompiler {
 #if V8_TARGET_ARCH_ARM64 || V8_TARGET_ARCH_X64
       if (memory->is_memory64()) {
         SCOPED_CODE_COMMENT("bounds check memory");
-        // Bounds check `index` against `max_mem_size - end_offset`, such that
-        // at runtime `index + end_offset` will be < `max_mem_size`, where the
-        // trap handler can handle out-of-bound accesses.
-        __ set_trap_on_oob_mem64(
-            index_ptrsize, memory->max_memory_size - end_offset, trap_label);
+        // Bounds check `index` such that at runtime `index + end_offset` will
+        // be within the reserved memory region, where the trap handler can
+        // handle out-of-bound accesses.
+        __ set_trap_on_oob_mem64(index_ptrsize,
+                                 memory->trap_handler_index_limit(end_offset),
+                                 trap_label);
       }
 #else
       CHECK(!memory->is_memory64());
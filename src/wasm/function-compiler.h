@@ -87,6 +87,8 @@ struct WasmCompilationResult {
   std::unique_ptr<AssumptionsJournal> assumptions;
   std::unique_ptr<LiftoffFrameDescriptionForDeopt> liftoff_frame_descriptions;
   int func_index = kAnonymousFuncIndex;
+  // Peak zone memory of the optimizing compiler's pipeline, or 0 if unknown.
+  size_t max_zone_size = 0;
   ExecutionTier result_tier = ExecutionTier::kNone;
   Kind kind = kFunction;
   ForDebugging for_debugging = kNotForDebugging;
@@ -956,6 +956,25 @@ class WasmGraphBuildingInterface {
       case WKI::kDataViewSetUint16:
       case WKI::kDataViewSetUint32:
       case WKI::kDataViewByteLength:
+      case WKI::kMathAbs:
+      case WKI::kMathAcos:
+      case WKI::kMathAsin:
+      case WKI::kMathAtan:
+      case WKI::kMathAtan2:
+      case WKI::kMathCeil:
+      case WKI::kMathClz32:
+      case WKI::kMathCos:
+      case WKI::kMathExp:
+      case WKI::kMathFloor:
+      case WKI::kMathImul:
+      case WKI::kMathLog:
+      case WKI::kMathMax:
+      case WKI::kMathMin:
+      case WKI::kMathPow:
+      case WKI::kMathSin:
+      case WKI::kMathSqrt:
+      case WKI::kMathTan:
+      case WKI::kMathTrunc:
       case WKI::kFastAPICall:
         return false;
     }
@@ -4,6 +4,8 @@
 
 #include "src/wasm/interpreter/wasm-interpreter-runtime.h"
 
+#include <algorithm>
+#include <cinttypes>
 #include <optional>
 
 #include "src/execution/frames-inl.h"
@@ -380,6 +382,11 @@ WasmInterpreterRuntime::WasmInterpreterRuntime(
 }
 
 WasmInterpreterRuntime::~WasmInterpreterRuntime() {
+#ifdef V8_ENABLE_DRUMBRAKE_TRACING
+  if (v8_flags.drumbrake_instruction_pair_profile) {
+    PrintInstructionPairProfile();
+  }
+#endif  // V8_ENABLE_DRUMBRAKE_TRACING
   GlobalHandles::Destroy(reference_stack_.location());
 }
 
@@ -2912,6 +2919,24 @@ void WasmInterpreterRuntime::Trace(const char* format, ...) {
     tracer->CheckFileSize();
   }
 }
+
+void WasmInterpreterRuntime::PrintInstructionPairProfile() const {
+  static constexpr size_t kMaxPrintedPairs = 32;
+  std::vector<std::pair<uint64_t, uint64_t>> pairs(
+      instruction_pair_counts_.begin(), instruction_pair_counts_.end());
+  std::sort(pairs.begin(), pairs.end(),
+            [](const auto& a, const auto& b) { return a.second > b.second; });
+
+  PrintF("Executed wasm instructions: %" PRIu64 "\n",
+         profiled_instruction_count_);
+  for (size_t i = 0; i < std::min(pairs.size(), kMaxPrintedPairs); i++) {
+    WasmOpcode first = static_cast<WasmOpcode>(pairs[i].first >> 32);
+    WasmOpcode second = static_cast<WasmOpcode>(pairs[i].first & 0xffffffff);
+    PrintF("%12" PRIu64 " (%5.2f%%)  %-24s %s\n", pairs[i].second,
+           100.0 * pairs[i].second / profiled_instruction_count_,
+           WasmOpcodes::OpcodeName(first), WasmOpcodes::OpcodeName(second));
+  }
+}
 #endif  // V8_ENABLE_DRUMBRAKE_TRACING
 
 // static
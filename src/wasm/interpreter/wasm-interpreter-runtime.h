@@ -10,6 +10,7 @@
 #define V8_WASM_INTERPRETER_WASM_INTERPRETER_RUNTIME_H_
 
 #include <memory>
+#include <unordered_map>
 #include <vector>
 
 #include "src/base/vector.h"
@@ -398,11 +399,27 @@ class WasmInterpreterRuntime {
     shadow_stack_->TraceSetSlotType(stack_index, type);
   }
 
+  // Counts the pair formed by {opcode} and the previously executed opcode.
+  void ProfileInstruction(uint32_t opcode) {
+    if (last_profiled_opcode_ != kNoProfiledOpcode) {
+      instruction_pair_counts_[(uint64_t{last_profiled_opcode_} << 32) |
+                               opcode]++;
+    }
+    last_profiled_opcode_ = opcode;
+    profiled_instruction_count_++;
+  }
+  void PrintInstructionPairProfile() const;
+
   // Used to redirect tracing output from {stdout} to a file.
   InterpreterTracer* GetTracer();
 
   std::unique_ptr<InterpreterTracer> tracer_;
   ShadowStack* shadow_stack_;
+
+  static constexpr uint32_t kNoProfiledOpcode = UINT32_MAX;
+  uint32_t last_profiled_opcode_ = kNoProfiledOpcode;
+  uint64_t profiled_instruction_count_ = 0;
+  std::unordered_map<uint64_t, uint64_t> instruction_pair_counts_;
 #endif  // V8_ENABLE_DRUMBRAKE_TRACING
 
   WasmInterpreterRuntime(const WasmInterpreterRuntime&) = delete;
@@ -5925,6 +5925,10 @@ INSTRUCTION_HANDLER_FUNC s2s_TraceInstruction(
   uint32_t opcode = ReadI32(code);
   uint32_t reg_mode = ReadI32(code);
 
+  if (v8_flags.drumbrake_instruction_pair_profile) {
+    wasm_runtime->ProfileInstruction(opcode);
+  }
+
   if (v8_flags.trace_drumbrake_execution) {
     wasm_runtime->Trace(
         "@%-3u:         %-24s: ", pc,
@@ -6383,15 +6387,21 @@ size_t WasmBytecodeGenerator::Simd128Hash::operator()(
 
 // Look if the slot that hold the value at {stack_index} is being shared with
 // other slots. This can happen if there are multiple load.get operations that
-// copy from the same local.
-bool WasmBytecodeGenerator::HasSharedSlot(uint32_t stack_index) const {
+// copy from the same local. The topmost {ignored_top_entries} entries are not
+// considered, which is used when they are operands consumed by an instruction
+// before it writes its result.
+bool WasmBytecodeGenerator::HasSharedSlot(uint32_t stack_index,
+                                          uint32_t ignored_top_entries) const {
   // Only consider stack entries added in the current block.
   // We don't need to consider ancestor blocks because if a block has a
   // non-empty signature we always pass arguments and results into separate
   // slots, emitting CopySlot operations.
   uint32_t start_slot_index = blocks_[current_block_index_].stack_size_;
+  DCHECK_LE(ignored_top_entries, stack_.size());
+  uint32_t end_slot_index =
+      static_cast<uint32_t>(stack_.size()) - ignored_top_entries;
 
-  for (uint32_t i = start_slot_index; i < stack_.size(); i++) {
+  for (uint32_t i = start_slot_index; i < end_slot_index; i++) {
     if (stack_[i] == stack_[stack_index]) {
       return true;
     }
@@ -7778,7 +7788,8 @@ RegMode WasmBytecodeGenerator::EncodeInstruction(const WasmInstruction& instr,
            GetRegModeString(next_reg_mode));
   }
 
-  if (v8_flags.trace_drumbrake_execution) {
+  if (v8_flags.trace_drumbrake_execution ||
+      v8_flags.drumbrake_instruction_pair_profile) {
     EMIT_INSTR_HANDLER(s2s_TraceInstruction);
     EmitI32Const(instr.pc);
     EmitI32Const(instr.opcode);
@@ -11169,6 +11180,36 @@ bool WasmBytecodeGenerator::EncodeSuperInstruction(
       STORE_CASE(F64StoreMem, Float64, uint64_t, kFloat64, F64);
 #undef STORE_CASE
 
+      default:
+        return false;
+    }
+  } else if (next_instr.orig == kExprLocalSet) {
+    // A non-trapping binary operator followed by local.set writes its result
+    // directly into the slot of the local, saving the dispatch of a CopySlot
+    // handler. The s2s_ and r2s_ handlers read their operands before writing
+    // the result, so the operands may share the slot of the local, but no
+    // other stack entry can.
+    uint32_t to_stack_index = next_instr.optional.index;
+    uint32_t operand_count = reg_mode == RegMode::kNoReg ? 2 : 1;
+    switch (curr_instr.orig) {
+#define BINOP_LOCAL_SET_CASE(name, ctype, reg, op, type)            \
+  case kExpr##name: {                                               \
+    if (HasSharedSlot(to_stack_index, operand_count)) return false; \
+    if (reg_mode == RegMode::kNoReg) {                              \
+      EMIT_INSTR_HANDLER(s2s_##name);                               \
+      type##Pop();                                                  \
+    } else {                                                        \
+      EMIT_INSTR_HANDLER(r2s_##name);                               \
+    }                                                               \
+    type##Pop();                                                    \
+    EmitI32Const(slots_[stack_[to_stack_index]].slot_offset);       \
+    reg_mode = RegMode::kNoReg;                                     \
+    return true;                                                    \
+  }
+      FOREACH_ARITHMETIC_BINOP(BINOP_LOCAL_SET_CASE)
+      FOREACH_MORE_BINOP(BINOP_LOCAL_SET_CASE)
+#undef BINOP_LOCAL_SET_CASE
+
       default:
         return false;
     }
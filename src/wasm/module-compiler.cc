@@ -630,6 +630,10 @@ class CompilationStateImpl {
   void CommitTopTierCompilationUnit(WasmCompilationUnit);
   void AddTopTierPriorityCompilationUnit(WasmCompilationUnit, size_t);
 
+  // Lets the compile job of the given tier spawn more workers again, e.g.
+  // after it was throttled by {--wasm-compile-memory-budget}.
+  void NotifyConcurrencyIncrease(CompilationTier tier);
+
   CompilationUnitQueues::Queue* GetQueueForCompileTask(int task_id);
 
   std::optional<WasmCompilationUnit> GetNextCompilationUnit(
@@ -651,6 +655,10 @@ class CompilationStateImpl {
   V8_WARN_UNUSED_RESULT WasmDetectedFeatures
       UpdateDetectedFeatures(WasmDetectedFeatures);
 
+  // Update the peak zone memory that compiling a single function of this
+  // module needed so far.
+  void RecordMaxZoneSize(int func_index, size_t max_zone_size);
+
   size_t NumOutstandingCompilations(CompilationTier tier) const;
 
   void SetError();
@@ -759,6 +767,9 @@ class CompilationStateImpl {
   // as a module is being compiled.
   std::atomic<WasmDetectedFeatures> detected_features_;
 
+  // Peak zone memory of a single compilation unit, see {RecordMaxZoneSize}.
+  std::atomic<size_t> max_zone_size_{0};
+
   //////////////////////////////////////////////////////////////////////////////
   // Protected by {mutex_}:
 
@@ -826,7 +837,7 @@ CompilationStateImpl* BackgroundCompileScope::compilation_state() const {
 }
 
 size_t CompilationStateImpl::EstimateCurrentMemoryConsumption() const {
-  UPDATE_WHEN_CLASS_CHANGES(CompilationStateImpl, 672);
+  UPDATE_WHEN_CLASS_CHANGES(CompilationStateImpl, 680);
   size_t result = sizeof(CompilationStateImpl);
 
   {
@@ -1192,6 +1203,26 @@ bool CompileLazy(Isolate* isolate,
   CompilationStateImpl* compilation_state =
       Impl(native_module->compilation_state());
   DebugState is_in_debug_state = native_module->IsInDebugState();
+
+  // Code from the module cache which was not materialized during
+  // deserialization only needs to be copied and relocated. Debugging requires
+  // freshly compiled code instead.
+  if (V8_UNLIKELY(native_module->deferred_deserialized_code()) &&
+      is_in_debug_state == kNotDebugging) {
+    WasmCodeRefScope code_ref_scope;
+    if (WasmCode* code =
+            MaterializeDeserializedCode(native_module, func_index)) {
+      // The function was initialized as lazy and not compiled; record that it
+      // reached the tier of the cached code now.
+      compilation_state->OnFinishedUnits(base::VectorOf(&code, 1));
+      if (V8_UNLIKELY(native_module->log_code())) {
+        GetWasmEngine()->LogCode(base::VectorOf(&code, 1));
+        GetWasmEngine()->LogOutstandingCodesForIsolate(isolate);
+      }
+      return true;
+    }
+  }
+
   ExecutionTierPair tiers =
       GetLazyCompilationTiers(native_module, func_index, is_in_debug_state);
 
@@ -2003,10 +2034,53 @@ const char* GetCompilationEventName(const WasmCompilationUnit& unit,
 
 constexpr uint8_t kMainTaskId = 0;
 
-// Run by the {BackgroundCompileJob} (on any thread).
+// Counts the workers of a {BackgroundCompileJob} which are executing
+// compilation units, such that all but one of them can yield while compilation
+// exceeds {--wasm-compile-memory-budget}.
+class V8_NODISCARD ActiveCompileWorkerScope {
+ public:
+  explicit ActiveCompileWorkerScope(std::atomic<int>* active_workers)
+      : active_workers_(active_workers) {
+    if (active_workers_) {
+      active_workers_->fetch_add(1, std::memory_order_relaxed);
+    }
+  }
+
+  ~ActiveCompileWorkerScope() {
+    if (active_workers_) {
+      active_workers_->fetch_sub(1, std::memory_order_relaxed);
+    }
+  }
+
+  ActiveCompileWorkerScope(const ActiveCompileWorkerScope&) = delete;
+  ActiveCompileWorkerScope& operator=(const ActiveCompileWorkerScope&) =
+      delete;
+
+  // Unregisters this worker unless it is the last active one. Returns true if
+  // the worker was unregistered and should yield.
+  bool TryLeave() {
+    if (!active_workers_) return false;
+    int workers = active_workers_->load(std::memory_order_relaxed);
+    while (workers > 1) {
+      if (active_workers_->compare_exchange_weak(workers, workers - 1,
+                                                 std::memory_order_relaxed)) {
+        active_workers_ = nullptr;
+        return true;
+      }
+    }
+    return false;
+  }
+
+ private:
+  std::atomic<int>* active_workers_;
+};
+
+// Run by the {BackgroundCompileJob} (on any thread). {active_workers} is the
+// worker count of that job, or nullptr if this thread must not be throttled.
 CompilationExecutionResult ExecuteCompilationUnits(
     std::weak_ptr<NativeModule> native_module, Counters* counters,
-    JobDelegate* delegate, CompilationTier tier) {
+    JobDelegate* delegate, CompilationTier tier,
+    std::atomic<int>* active_workers) {
   TRACE_EVENT0("v8.wasm", "wasm.ExecuteCompilationUnits");
 
   // Compilation must be disabled in jitless mode.
@@ -2043,6 +2117,10 @@ CompilationExecutionResult ExecuteCompilationUnits(
   TRACE_COMPILE("ExecuteCompilationUnits (task id %d)\n", task_id);
 
   std::vector<WasmCompilationResult> results_to_publish;
+  ActiveCompileWorkerScope active_worker_scope(active_workers);
+  // Set while this task runs as the only worker because compilation memory
+  // exceeded {--wasm-compile-memory-budget}.
+  bool throttled = false;
   while (true) {
     ExecutionTier current_tier = unit->tier();
     const char* event_name = GetCompilationEventName(unit.value(), env.value());
@@ -2058,11 +2136,16 @@ CompilationExecutionResult ExecuteCompilationUnits(
       global_detected_features.Add(per_function_detected_features);
       bool compilation_succeeded = result.succeeded();
       ExecutionTier result_tier = result.result_tier;
+      size_t max_zone_size = result.max_zone_size;
       // We don't eagerly compile import wrappers any more.
       DCHECK_GE(unit->func_index(), env->module->num_imported_functions);
       results_to_publish.emplace_back(std::move(result));
 
       bool yield = delegate && delegate->ShouldYield();
+      // While over the compilation memory budget, all background workers but
+      // one yield to let memory drain.
+      bool over_budget = GetWasmEngine()->IsCompileMemoryBudgetExceeded();
+      if (over_budget && active_worker_scope.TryLeave()) yield = true;
 
       // (synchronized): Publish the compilation result and get the next unit.
       BackgroundCompileScope compile_scope(native_module);
@@ -2077,6 +2160,19 @@ CompilationExecutionResult ExecuteCompilationUnits(
         compile_scope.native_module()->AddLiftoffBailout();
       }
 
+      if (max_zone_size != 0) {
+        compile_scope.compilation_state()->RecordMaxZoneSize(unit->func_index(),
+                                                             max_zone_size);
+      }
+
+      if (over_budget) {
+        throttled = true;
+      } else if (throttled) {
+        // Memory was freed, allow more workers again.
+        compile_scope.compilation_state()->NotifyConcurrencyIncrease(tier);
+        throttled = false;
+      }
+
       // Yield or get next unit.
       if (yield ||
           !(unit = compile_scope.compilation_state()->GetNextCompilationUnit(
@@ -2311,7 +2407,7 @@ class BackgroundCompileJob final : public JobTask {
     auto engine_scope = engine_barrier_->TryLock();
     if (!engine_scope) return;
     ExecuteCompilationUnits(native_module_, async_counters_.get(), delegate,
-                            tier_);
+                            tier_, &active_workers_);
   }
 
   size_t GetMaxConcurrency(size_t worker_count) const override {
@@ -2319,6 +2415,8 @@ class BackgroundCompileJob final : public JobTask {
     if (compile_scope.cancelled()) return 0;
     size_t flag_limit = static_cast<size_t>(
         std::max(1, v8_flags.wasm_num_compilation_tasks.value()));
+    // Run a single worker while compilation exceeds its memory budget.
+    if (GetWasmEngine()->IsCompileMemoryBudgetExceeded()) flag_limit = 1;
     // NumOutstandingCompilations() does not reflect the units that running
     // workers are processing, thus add the current worker count to that number.
     return std::min(flag_limit,
@@ -2331,6 +2429,9 @@ class BackgroundCompileJob final : public JobTask {
   std::shared_ptr<OperationsBarrier> engine_barrier_;
   const std::shared_ptr<Counters> async_counters_;
   const CompilationTier tier_;
+  // Workers currently in {ExecuteCompilationUnits}, see
+  // {ActiveCompileWorkerScope}.
+  std::atomic<int> active_workers_{0};
 };
 
 std::shared_ptr<NativeModule> GetOrCompileNewNativeModule(
@@ -3956,6 +4057,12 @@ void CompilationStateImpl::AddTopTierPriorityCompilationUnit(
   top_tier_compile_job_->NotifyConcurrencyIncrease();
 }
 
+void CompilationStateImpl::NotifyConcurrencyIncrease(CompilationTier tier) {
+  JobHandle* job = tier == kBaseline ? baseline_compile_job_.get()
+                                     : top_tier_compile_job_.get();
+  if (job->IsValid()) job->NotifyConcurrencyIncrease();
+}
+
 CompilationUnitQueues::Queue* CompilationStateImpl::GetQueueForCompileTask(
     int task_id) {
   return compilation_unit_queues_.GetQueueForTask(task_id);
@@ -4223,6 +4330,22 @@ WasmDetectedFeatures CompilationStateImpl::UpdateDetectedFeatures(
   return detected_features - old_features;
 }
 
+void CompilationStateImpl::RecordMaxZoneSize(int func_index,
+                                             size_t max_zone_size) {
+  size_t old_max = max_zone_size_.load(std::memory_order_relaxed);
+  do {
+    if (max_zone_size <= old_max) return;
+  } while (!max_zone_size_.compare_exchange_weak(old_max, max_zone_size,
+                                                  std::memory_order_relaxed));
+  if (V8_UNLIKELY(v8_flags.trace_wasm_compile_memory)) {
+    PrintF(
+        "[wasm] module %p: new peak compile zone size of %zu bytes (function "
+        "#%d); %zu bytes used by all zones\n",
+        native_module_, max_zone_size, func_index,
+        GetWasmEngine()->allocator()->GetCurrentMemoryUsage());
+  }
+}
+
 void CompilationStateImpl::PublishCompilationResults(
     std::vector<std::unique_ptr<WasmCode>> unpublished_code) {
   if (unpublished_code.empty()) return;
@@ -4342,7 +4465,7 @@ void CompilationStateImpl::TierUpAllFunctions() {
 
   DummyDelegate delegate;
   ExecuteCompilationUnits(native_module_weak_, async_counters_.get(), &delegate,
-                          CompilationTier::kTopTier);
+                          CompilationTier::kTopTier, nullptr);
 
   // We cannot wait for other compilation threads to finish, so we explicitly
   // compile all functions which are not yet available as TurboFan code.
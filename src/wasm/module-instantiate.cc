@@ -386,6 +386,18 @@ bool IsDataViewSetterSig(const wasm::CanonicalSig* sig,
          sig->GetParam(3) == wasm::kCanonicalI32;
 }
 
+// Checks for signatures of the form (t, ..., t) -> t with {param_count}
+// parameters.
+bool IsUniformSig(const wasm::CanonicalSig* sig, size_t param_count,
+                  wasm::CanonicalValueType type) {
+  if (sig->parameter_count() != param_count) return false;
+  if (sig->return_count() != 1 || sig->GetReturn(0) != type) return false;
+  for (wasm::CanonicalValueType param : sig->parameters()) {
+    if (param != type) return false;
+  }
+  return true;
+}
+
 const MachineSignature* GetFunctionSigForFastApiImport(
     Zone* zone, const CFunctionInfo* info) {
   uint32_t arg_count = info->ArgumentCount();
@@ -433,6 +445,43 @@ WellKnownImport CheckForWellKnownImport(
           return WellKnownImport::kParseFloat;
         }
         break;
+      // For these signatures, the Math functions have the same semantics as
+      // the corresponding Wasm (or asm.js) operators, so calls to them can be
+      // replaced by the operators.
+      // Arbitrary monomorphic JS imports are not inlined instead: Wasm code
+      // belongs to the NativeModule and is shared by all instances (and
+      // isolates) of a module, so it cannot embed one instance's closure or
+      // the JS feedback that inlining its body would need. Wasm deopts only
+      // return to Liftoff code of the same module; they cannot react to JS
+      // state changing under the inlined body. Specializing on the builtin
+      // behind an import needs neither: the well-known status is checked at
+      // instantiation, and a mismatch discards the specialized code.
+#define MATH_IMPORT(Name, param_count, type)                        \
+  case Builtin::kMath##Name:                                        \
+    if (IsUniformSig(sig, param_count, wasm::kCanonical##type)) {   \
+      return WellKnownImport::kMath##Name;                          \
+    }                                                               \
+    break;
+      MATH_IMPORT(Abs, 1, F64)
+      MATH_IMPORT(Acos, 1, F64)
+      MATH_IMPORT(Asin, 1, F64)
+      MATH_IMPORT(Atan, 1, F64)
+      MATH_IMPORT(Ceil, 1, F64)
+      MATH_IMPORT(Cos, 1, F64)
+      MATH_IMPORT(Exp, 1, F64)
+      MATH_IMPORT(Floor, 1, F64)
+      MATH_IMPORT(Log, 1, F64)
+      MATH_IMPORT(Sin, 1, F64)
+      MATH_IMPORT(Sqrt, 1, F64)
+      MATH_IMPORT(Tan, 1, F64)
+      MATH_IMPORT(Trunc, 1, F64)
+      MATH_IMPORT(Atan2, 2, F64)
+      MATH_IMPORT(Max, 2, F64)
+      MATH_IMPORT(Min, 2, F64)
+      MATH_IMPORT(Pow, 2, F64)
+      MATH_IMPORT(Clz32, 1, I32)
+      MATH_IMPORT(Imul, 2, I32)
+#undef MATH_IMPORT
       default:
         break;
     }
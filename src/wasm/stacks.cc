@@ -6,6 +6,7 @@
 
 #include "src/base/platform/platform.h"
 #include "src/execution/simulator.h"
+#include "src/utils/utils.h"
 #include "src/wasm/wasm-engine.h"
 
 namespace v8::internal::wasm {
@@ -36,6 +37,7 @@ StackMemory::StackMemory() : owned_(true) {
   active_segment_ = first_segment_;
   size_ = first_segment_->size_;
   limit_ = first_segment_->limit_;
+  high_water_mark_ = first_segment_->base();
   if (v8_flags.trace_wasm_stack_switching) {
     PrintF("Allocate stack #%d (limit: %p, base: %p, size: %zu)\n", id_, limit_,
            limit_ + size_, size_);
@@ -65,6 +67,10 @@ StackMemory::StackSegment::~StackSegment() {
 
 bool StackMemory::Grow(Address current_fp) {
   DCHECK(owned_);
+  if (active_segment_ == first_segment_) {
+    // The first segment is exhausted, so all of its pages are dirty now.
+    high_water_mark_ = reinterpret_cast<Address>(first_segment_->limit_);
+  }
   if (active_segment_->next_segment_ != nullptr) {
     active_segment_ = active_segment_->next_segment_;
   } else {
@@ -115,8 +121,55 @@ void StackMemory::Reset() {
   size_ = active_segment_->size_;
 }
 
+void StackMemory::ReleaseUnusedMemory() {
+  DCHECK(owned_);
+  DCHECK_EQ(active_segment_, first_segment_);
+  // A computation that never grew the stack only dirtied part of the first
+  // segment, which the next computation is likely to need again.
+  if (high_water_mark_ == first_segment_->base()) return;
+
+  // A stack that finished normally is retired from a C call on the stack
+  // itself (see {return_switch}), at its first segment. The pages of the
+  // current frames and of the calls below them must be kept.
+  Address current_position = GetCurrentStackPosition();
+  auto in_segment = [current_position](const StackSegment* segment) {
+    return reinterpret_cast<Address>(segment->limit_) <= current_position &&
+           current_position < segment->base();
+  };
+  auto segment = first_segment_->next_segment_;
+  for (auto grown = segment; grown; grown = grown->next_segment_) {
+    if (in_segment(grown)) return;
+  }
+  while (segment) {
+    auto next_segment = segment->next_segment_;
+    delete segment;
+    segment = next_segment;
+  }
+  first_segment_->next_segment_ = nullptr;
+
+  // Discard the dirty pages of the first segment, except for the page at its
+  // base.
+  PageAllocator* allocator = GetPlatformPageAllocator();
+  size_t page_size = allocator->CommitPageSize();
+  Address start = RoundDown(high_water_mark_, page_size);
+  Address end = first_segment_->base() - page_size;
+  if (in_segment(first_segment_)) {
+    end = std::min(end, RoundDown(current_position - kJSLimitOffsetKB * KB,
+                                  page_size));
+  }
+  if (start < end) {
+    USE(allocator->DiscardSystemPages(reinterpret_cast<void*>(start),
+                                      end - start));
+  }
+  high_water_mark_ = first_segment_->base();
+  if (v8_flags.trace_wasm_stack_switching) {
+    PrintF("Release unused memory of stack #%d\n", id_);
+  }
+}
+
 std::unique_ptr<StackMemory> StackPool::GetOrAllocate() {
-  while (size_ > kMaxSize) {
+  const size_t max_size = v8_flags.wasm_stack_pool_size * KB;
+  while (size_ > max_size) {
     size_ -= freelist_.back()->allocated_size();
     freelist_.pop_back();
   }
@@ -136,11 +189,15 @@ std::unique_ptr<StackMemory> StackPool::GetOrAllocate() {
 }
 
 void StackPool::Add(std::unique_ptr<StackMemory> stack) {
-  // Add the stack to the pool regardless of kMaxSize, because the stack might
-  // still be in use by the unwinder.
+  // Add the stack to the pool regardless of the pool size limit, because the
+  // stack might still be in use by the unwinder.
   // Shrink the freelist lazily when we get the next stack instead.
-  size_ += stack->allocated_size();
   stack->Reset();
+  // The finished computation might have been much deeper than the next one on
+  // this stack. Give that memory back to the OS now, so that pooled stacks do
+  // not keep it resident.
+  stack->ReleaseUnusedMemory();
+  size_ += stack->allocated_size();
   freelist_.push_back(std::move(stack));
 }
 
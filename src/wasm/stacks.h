@@ -112,6 +112,11 @@ class StackMemory {
   bool Grow(Address current_fp);
   Address Shrink();
   void Reset();
+  // If the stack grew since it was last released, frees the segments that
+  // were added by {Grow} and returns the dirty pages of the first segment to
+  // the OS, except for the pages that are still in use at its base. The
+  // computation on the stack must have finished.
+  void ReleaseUnusedMemory();
 
   class StackSegment {
    public:
@@ -176,6 +181,9 @@ class StackMemory {
   std::optional<StackSwitchInfo> stack_switch_info_;
   StackSegment* first_segment_ = nullptr;
   StackSegment* active_segment_ = nullptr;
+  // Lowest address of the first segment that was used since the memory was
+  // last released: its limit if the stack grew beyond it, else its base.
+  Address high_water_mark_ = kNullAddress;
 };
 
 // A pool of "finished" stacks, i.e. stacks whose last frame have returned and
@@ -192,10 +200,9 @@ class StackPool {
 
  private:
   std::vector<std::unique_ptr<StackMemory>> freelist_;
+  // Total allocated size of the stacks in the free list. If it is above
+  // {--wasm-stack-pool-size}, stacks are freed when we get the next stack.
   size_t size_ = 0;
-  // If the next finished stack would move the total size above this limit, the
-  // stack is freed instead of being added to the free list.
-  static constexpr int kMaxSize = 4 * MB;
 };
 
 }  // namespace v8::internal::wasm
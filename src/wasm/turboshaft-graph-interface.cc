@@ -2636,6 +2636,65 @@ class TurboshaftGraphBuildingInterface : public WasmGraphBuilderBase {
         }
         break;
       }
+
+      // Math functions, see {CheckForWellKnownImport} for the signatures.
+      case WKI::kMathAbs:
+        result = UnOpImpl(kExprF64Abs, args[0].op, kWasmF64);
+        break;
+      case WKI::kMathAcos:
+        result = UnOpImpl(kExprF64Acos, args[0].op, kWasmF64);
+        break;
+      case WKI::kMathAsin:
+        result = UnOpImpl(kExprF64Asin, args[0].op, kWasmF64);
+        break;
+      case WKI::kMathAtan:
+        result = UnOpImpl(kExprF64Atan, args[0].op, kWasmF64);
+        break;
+      case WKI::kMathCeil:
+        result = UnOpImpl(kExprF64Ceil, args[0].op, kWasmF64);
+        break;
+      case WKI::kMathCos:
+        result = UnOpImpl(kExprF64Cos, args[0].op, kWasmF64);
+        break;
+      case WKI::kMathExp:
+        result = UnOpImpl(kExprF64Exp, args[0].op, kWasmF64);
+        break;
+      case WKI::kMathFloor:
+        result = UnOpImpl(kExprF64Floor, args[0].op, kWasmF64);
+        break;
+      case WKI::kMathLog:
+        result = UnOpImpl(kExprF64Log, args[0].op, kWasmF64);
+        break;
+      case WKI::kMathSin:
+        result = UnOpImpl(kExprF64Sin, args[0].op, kWasmF64);
+        break;
+      case WKI::kMathSqrt:
+        result = UnOpImpl(kExprF64Sqrt, args[0].op, kWasmF64);
+        break;
+      case WKI::kMathTan:
+        result = UnOpImpl(kExprF64Tan, args[0].op, kWasmF64);
+        break;
+      case WKI::kMathTrunc:
+        result = UnOpImpl(kExprF64Trunc, args[0].op, kWasmF64);
+        break;
+      case WKI::kMathAtan2:
+        result = BinOpImpl(kExprF64Atan2, args[0].op, args[1].op);
+        break;
+      case WKI::kMathMax:
+        result = BinOpImpl(kExprF64Max, args[0].op, args[1].op);
+        break;
+      case WKI::kMathMin:
+        result = BinOpImpl(kExprF64Min, args[0].op, args[1].op);
+        break;
+      case WKI::kMathPow:
+        result = BinOpImpl(kExprF64Pow, args[0].op, args[1].op);
+        break;
+      case WKI::kMathClz32:
+        result = UnOpImpl(kExprI32Clz, args[0].op, kWasmI32);
+        break;
+      case WKI::kMathImul:
+        result = BinOpImpl(kExprI32Mul, args[0].op, args[1].op);
+        break;
       case WKI::kFastAPICall: {
         WellKnown_FastApi(decoder, imm, args, returns);
         result = returns[0].op;
@@ -4524,17 +4583,24 @@ class TurboshaftGraphBuildingInterface : public WasmGraphBuilderBase {
                  const ArrayIndexImmediate& src_imm, const Value& length) {
     V<WasmArrayNullable> src_array = V<WasmArrayNullable>::Cast(src.op);
     V<WasmArrayNullable> dst_array = V<WasmArrayNullable>::Cast(dst.op);
-    BoundsCheckArrayWithLength(dst_array, dst_index.op, length.op,
-                               dst.type.is_nullable()
-                                   ? compiler::kWithNullCheck
-                                   : compiler::kWithoutNullCheck);
-    BoundsCheckArrayWithLength(src_array, src_index.op, length.op,
-                               src.type.is_nullable()
-                                   ? compiler::kWithNullCheck
-                                   : compiler::kWithoutNullCheck);
+    V<WasmArray> dst_array_not_null = BoundsCheckArrayWithLength(
+        dst_array, dst_index.op, length.op,
+        dst.type.is_nullable() ? compiler::kWithNullCheck
+                               : compiler::kWithoutNullCheck);
+    V<WasmArray> src_array_not_null = BoundsCheckArrayWithLength(
+        src_array, src_index.op, length.op,
+        src.type.is_nullable() ? compiler::kWithNullCheck
+                               : compiler::kWithoutNullCheck);
 
     ValueType element_type = src_imm.array_type->element_type();
 
+    if (element_type.is_numeric()) {
+      ArrayCopyWithMemmove(dst_array_not_null, dst_index.op,
+                           src_array_not_null, src_index.op, length.op,
+                           element_type);
+      return;
+    }
+
     IF_NOT (__ Word32Equal(length.op, 0)) {
       // Values determined by test/mjsunit/wasm/array-copy-benchmark.js on x64.
       int array_copy_max_loop_length;
@@ -4685,6 +4751,27 @@ class TurboshaftGraphBuildingInterface : public WasmGraphBuilderBase {
     // TODO(14616): Is this too restrictive?
     DCHECK_EQ(segment_is_shared,
               decoder->module_->type(array_imm.index).is_shared);
+    if (!is_element) {
+      // Data segments are plain bytes, so they can be copied into the array
+      // without a runtime call.
+      V<WasmArray> array_not_null = BoundsCheckArrayWithLength(
+          V<WasmArrayNullable>::Cast(array.op), array_index.op, length.op,
+          array.type.is_nullable() ? compiler::kWithNullCheck
+                                   : compiler::kWithoutNullCheck);
+      auto sig = FixedSizeSignature<MachineType>::Returns(MachineType::Int32())
+                     .Params(MachineType::Pointer(), MachineType::Uint32(),
+                             MachineType::TaggedPointer(),
+                             MachineType::Uint32(), MachineType::Uint32(),
+                             MachineType::Uint32());
+      V<Word32> result = CallC(
+          &sig, ExternalReference::wasm_array_init_data(),
+          {__ BitcastHeapObjectToWordPtr(
+               trusted_instance_data(segment_is_shared)),
+           __ Word32Constant(segment_imm.index), array_not_null,
+           array_index.op, segment_offset.op, length.op});
+      __ TrapIfNot(result, TrapId::kTrapDataSegmentOutOfBounds);
+      return;
+    }
     CallBuiltinThroughJumptable<BuiltinCallDescriptor::WasmArrayInitSegment>(
         decoder,
         {array_index.op, segment_offset.op, length.op,
@@ -7071,12 +7158,13 @@ class TurboshaftGraphBuildingInterface : public WasmGraphBuilderBase {
         enforce_bounds_check ==
             compiler::EnforceBoundsCheck::kCanOmitBoundsCheck) {
       if (memory->is_memory64()) {
-        // Bounds check `index` against `max_mem_size - end_offset`, such that
-        // at runtime `index + end_offset` will be within `max_mem_size`, where
-        // the trap handler can handle out-of-bound accesses.
+        // Bounds check `index` such that at runtime `index + end_offset` will
+        // be within the reserved memory region, where the trap handler can
+        // handle out-of-bound accesses. Accesses with the same index share
+        // the same check, so that redundant checks are eliminated.
         V<Word32> cond = __ Uint64LessThan(
             V<Word64>::Cast(converted_index),
-            __ Word64Constant(uint64_t{memory->max_memory_size - end_offset}));
+            __ Word64Constant(memory->trap_handler_index_limit(end_offset)));
         __ TrapIfNot(cond, TrapId::kTrapMemOutOfBounds);
       }
       return {converted_index, compiler::BoundsCheckResult::kTrapHandler};
@@ -8026,6 +8114,31 @@ class TurboshaftGraphBuildingInterface : public WasmGraphBuilderBase {
     BIND(done);
   }
 
+  // Numeric elements need no write barrier, so they are moved with a single
+  // call to memmove, which also handles overlapping ranges. As a call, it
+  // invalidates what load elimination knows about both arrays, which raw
+  // stores into the arrays would not.
+  void ArrayCopyWithMemmove(V<WasmArray> dst_array, V<Word32> dst_index,
+                            V<WasmArray> src_array, V<Word32> src_index,
+                            V<Word32> length, wasm::ValueType element_type) {
+    const int size_log2 = element_type.value_kind_size_log2();
+    auto element_address = [&](V<WasmArray> array, V<Word32> index) {
+      V<WordPtr> offset =
+          __ WordPtrShiftLeft(__ ChangeUint32ToUintPtr(index), size_log2);
+      return __ WordPtrAdd(
+          __ BitcastHeapObjectToWordPtr(array),
+          __ WordPtrAdd(offset, WasmArray::kHeaderSize - kHeapObjectTag));
+    };
+    V<WordPtr> byte_length =
+        __ WordPtrShiftLeft(__ ChangeUint32ToUintPtr(length), size_log2);
+    auto sig = FixedSizeSignature<MachineType>::Returns(MachineType::Pointer())
+                   .Params(MachineType::Pointer(), MachineType::Pointer(),
+                           MachineType::UintPtr());
+    CallC(&sig, ExternalReference::libc_memmove_function(),
+          {element_address(dst_array, dst_index),
+           element_address(src_array, src_index), byte_length});
+  }
+
   V<WordPtr> StoreInInt64StackSlot(OpIndex value, wasm::ValueType type) {
     OpIndex value_int64;
     switch (type.kind()) {
@@ -8446,18 +8559,16 @@ class TurboshaftGraphBuildingInterface : public WasmGraphBuilderBase {
 };
 
 V8_EXPORT_PRIVATE void BuildTSGraph(
-    compiler::turboshaft::PipelineData* data, AccountingAllocator* allocator,
-    CompilationEnv* env, WasmDetectedFeatures* detected, Graph& graph,
-    const FunctionBody& func_body, const WireBytesStorage* wire_bytes,
-    AssumptionsJournal* assumptions,
+    compiler::turboshaft::PipelineData* data, Zone* zone, CompilationEnv* env,
+    WasmDetectedFeatures* detected, Graph& graph, const FunctionBody& func_body,
+    const WireBytesStorage* wire_bytes, AssumptionsJournal* assumptions,
     ZoneVector<WasmInliningPosition>* inlining_positions, int func_index) {
   DCHECK(env->module->function_was_validated(func_index));
-  Zone zone(allocator, ZONE_NAME);
-  WasmGraphBuilderBase::Assembler assembler(data, graph, graph, &zone);
+  WasmGraphBuilderBase::Assembler assembler(data, graph, graph, zone);
   WasmFullDecoder<TurboshaftGraphBuildingInterface::ValidationTag,
                   TurboshaftGraphBuildingInterface>
-      decoder(&zone, env->module, env->enabled_features, detected, func_body,
-              &zone, env, assembler, assumptions, inlining_positions,
+      decoder(zone, env->module, env->enabled_features, detected, func_body,
+              zone, env, assembler, assumptions, inlining_positions,
               func_index, func_body.is_shared, wire_bytes);
   decoder.Decode();
   // The function was already validated, so graph building must always succeed.
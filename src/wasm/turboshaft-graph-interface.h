@@ -42,7 +42,7 @@ class TurboshaftGraphBuildingInterface;
 struct CompilationEnv;
 
 V8_EXPORT_PRIVATE void BuildTSGraph(
-    compiler::turboshaft::PipelineData* data, AccountingAllocator* allocator,
+    compiler::turboshaft::PipelineData* data, Zone* zone,
     CompilationEnv* env, WasmDetectedFeatures* detected,
     compiler::turboshaft::Graph& graph, const FunctionBody& func_body,
     const WireBytesStorage* wire_bytes, AssumptionsJournal* assumptions,
@@ -48,6 +48,7 @@
 #include "src/wasm/wasm-module.h"
 #include "src/wasm/wasm-objects-inl.h"
 #include "src/wasm/wasm-objects.h"
+#include "src/wasm/wasm-serialization.h"
 #include "src/wasm/well-known-imports.h"
 
 #if V8_ENABLE_DRUMBRAKE
@@ -2103,6 +2104,12 @@ NativeModule::~NativeModule() {
   FreeCodePointerTableHandles();
 }
 
+void NativeModule::set_deferred_deserialized_code(
+    std::unique_ptr<DeferredDeserializedCode> code) {
+  DCHECK_NULL(deferred_deserialized_code_);
+  deferred_deserialized_code_ = std::move(code);
+}
+
 WasmCodeManager::WasmCodeManager()
     : max_committed_code_space_(v8_flags.wasm_max_committed_code_mb * MB),
       critical_committed_code_space_(max_committed_code_space_ / 2),
@@ -46,6 +46,7 @@ namespace wasm {
 
 class AssumptionsJournal;
 class DebugInfo;
+class DeferredDeserializedCode;
 class NamesProvider;
 class NativeModule;
 struct WasmCompilationResult;
@@ -708,6 +709,14 @@ class V8_EXPORT_PRIVATE NativeModule final {
   }
   void set_lazy_compile_frozen(bool frozen) { lazy_compile_frozen_ = frozen; }
   bool lazy_compile_frozen() const { return lazy_compile_frozen_; }
+  // Code whose copying and relocation was deferred during deserialization (see
+  // --wasm-lazy-deserialization). This is set once before the module is shared
+  // and is {nullptr} otherwise.
+  DeferredDeserializedCode* deferred_deserialized_code() const {
+    return deferred_deserialized_code_.get();
+  }
+  void set_deferred_deserialized_code(
+      std::unique_ptr<DeferredDeserializedCode> code);
   base::Vector<const uint8_t> wire_bytes() const {
     return std::atomic_load(&wire_bytes_)->as_vector();
   }
@@ -1075,6 +1084,7 @@ class V8_EXPORT_PRIVATE NativeModule final {
   //////////////////////////////////////////////////////////////////////////////
 
   bool lazy_compile_frozen_ = false;
+  std::unique_ptr<DeferredDeserializedCode> deferred_deserialized_code_;
   std::atomic<size_t> liftoff_bailout_count_{0};
   std::atomic<size_t> liftoff_code_size_{0};
   std::atomic<size_t> turbofan_code_size_{0};
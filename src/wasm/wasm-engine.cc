@@ -287,6 +287,9 @@ std::shared_ptr<NativeModule> NativeModuleCache::MaybeGetNativeModule(
     const CompileTimeImports& compile_imports) {
   if (!v8_flags.wasm_native_module_cache) return nullptr;
   if (origin != kWasmOrigin) return nullptr;
+  // Evicted modules are dropped after releasing the mutex, since their
+  // destruction calls back into {Erase}.
+  std::vector<std::shared_ptr<NativeModule>> evicted;
   base::MutexGuard lock(&mutex_);
   size_t prefix_hash = PrefixHash(wire_bytes);
   NativeModuleCache::Key key{prefix_hash, compile_imports, wire_bytes};
@@ -313,6 +316,7 @@ std::shared_ptr<NativeModule> NativeModuleCache::MaybeGetNativeModule(
             shared_native_module->compile_imports().compare(compile_imports),
             0);
         DCHECK_EQ(shared_native_module->wire_bytes(), wire_bytes);
+        KeepAlive(shared_native_module, &evicted);
         return shared_native_module;
       }
     }
@@ -322,6 +326,23 @@ std::shared_ptr<NativeModule> NativeModuleCache::MaybeGetNativeModule(
   }
 }
 
+std::shared_ptr<NativeModule> NativeModuleCache::TryGetNativeModule(
+    ModuleOrigin origin, base::Vector<const uint8_t> wire_bytes,
+    const CompileTimeImports& compile_imports) {
+  if (!v8_flags.wasm_native_module_cache) return nullptr;
+  if (origin != kWasmOrigin) return nullptr;
+  std::vector<std::shared_ptr<NativeModule>> evicted;
+  base::MutexGuard lock(&mutex_);
+  NativeModuleCache::Key key{PrefixHash(wire_bytes), compile_imports,
+                             wire_bytes};
+  auto it = map_.find(key);
+  if (it == map_.end() || !it->second.has_value()) return nullptr;
+  std::shared_ptr<NativeModule> shared_native_module =
+      it->second.value().lock();
+  if (shared_native_module) KeepAlive(shared_native_module, &evicted);
+  return shared_native_module;
+}
+
 bool NativeModuleCache::GetStreamingCompilationOwnership(
     size_t prefix_hash, const CompileTimeImports& compile_imports) {
   if (!v8_flags.wasm_native_module_cache) return true;
@@ -355,6 +376,7 @@ std::shared_ptr<NativeModule> NativeModuleCache::Update(
   base::Vector<const uint8_t> wire_bytes = native_module->wire_bytes();
   DCHECK(!wire_bytes.empty());
   size_t prefix_hash = PrefixHash(native_module->wire_bytes());
+  std::vector<std::shared_ptr<NativeModule>> evicted;
   base::MutexGuard lock(&mutex_);
   const CompileTimeImports& compile_imports = native_module->compile_imports();
   map_.erase(Key{prefix_hash, compile_imports, {}});
@@ -369,6 +391,7 @@ std::shared_ptr<NativeModule> NativeModuleCache::Update(
         // That in turn can call {NativeModuleCache::Erase}, which takes the
         // mutex. This is not a problem though, since the {MutexGuard} above is
         // released before the {native_module}, per the definition order.
+        KeepAlive(conflicting_module, &evicted);
         return conflicting_module;
       }
     }
@@ -381,6 +404,7 @@ std::shared_ptr<NativeModule> NativeModuleCache::Update(
     [[maybe_unused]] auto [iterator, inserted] = map_.emplace(
         key, std::optional<std::weak_ptr<NativeModule>>(native_module));
     DCHECK(inserted);
+    KeepAlive(native_module, &evicted);
   }
   cache_cv_.NotifyAll();
   return native_module;
@@ -398,6 +422,30 @@ void NativeModuleCache::Erase(NativeModule* native_module) {
   cache_cv_.NotifyAll();
 }
 
+void NativeModuleCache::ReleaseKeptAlive() {
+  std::list<std::shared_ptr<NativeModule>> released;
+  base::MutexGuard lock(&mutex_);
+  released.swap(kept_alive_);
+}
+
+void NativeModuleCache::KeepAlive(
+    std::shared_ptr<NativeModule> native_module,
+    std::vector<std::shared_ptr<NativeModule>>* evicted) {
+  mutex_.AssertHeld();
+  size_t limit = v8_flags.wasm_native_module_cache_keep_alive;
+  if (limit == 0) return;
+  auto it = std::find(kept_alive_.begin(), kept_alive_.end(), native_module);
+  if (it != kept_alive_.end()) {
+    kept_alive_.splice(kept_alive_.begin(), kept_alive_, it);
+    return;
+  }
+  kept_alive_.push_front(std::move(native_module));
+  while (kept_alive_.size() > limit) {
+    evicted->push_back(std::move(kept_alive_.back()));
+    kept_alive_.pop_back();
+  }
+}
+
 // static
 size_t NativeModuleCache::PrefixHash(base::Vector<const uint8_t> wire_bytes) {
   // Compute the hash as a combined hash of the sections up to the code section
@@ -530,7 +578,9 @@ struct WasmEngine::NativeModuleInfo {
   std::unordered_set<Isolate*> isolates;
 };
 
-WasmEngine::WasmEngine() : call_descriptors_(&allocator_) {}
+WasmEngine::WasmEngine() : call_descriptors_(&allocator_) {
+  allocator_.ConfigureSegmentPool(v8_flags.wasm_compile_zone_pool_size * KB);
+}
 
 WasmEngine::~WasmEngine() {
 #ifdef V8_ENABLE_WASM_GDB_REMOTE_DEBUGGING
@@ -544,6 +594,9 @@ WasmEngine::~WasmEngine() {
     delete native_modules_kept_alive_for_pgo;
   }
 
+  // Same for the native modules kept alive by the native module cache.
+  native_module_cache_.ReleaseKeptAlive();
+
   operations_barrier_->CancelAndWait();
 
   // All code should have been deleted already, but wrappers managed by the
@@ -1106,6 +1159,16 @@ std::pair<size_t, size_t> WasmEngine::FlushLiftoffCode() {
   return {removed_code_size, removed_metadata_size};
 }
 
+void WasmEngine::ReleaseCachedNativeModules() {
+  native_module_cache_.ReleaseKeptAlive();
+}
+
+bool WasmEngine::IsCompileMemoryBudgetExceeded() const {
+  size_t budget_mb = v8_flags.wasm_compile_memory_budget;
+  if (budget_mb == 0) return false;
+  return allocator_.GetCurrentMemoryUsage() >= budget_mb * MB;
+}
+
 size_t WasmEngine::GetLiftoffCodeSizeForTesting() {
   base::MutexGuard guard(&mutex_);
   size_t codesize_liftoff = 0;
@@ -1608,9 +1671,25 @@ std::shared_ptr<NativeModule> WasmEngine::MaybeGetNativeModule(
   std::shared_ptr<NativeModule> native_module =
       native_module_cache_.MaybeGetNativeModule(origin, wire_bytes,
                                                 compile_imports);
+  if (native_module) OnNativeModuleCacheHit(native_module, isolate);
+  return native_module;
+}
+
+std::shared_ptr<NativeModule> WasmEngine::TryGetCachedNativeModule(
+    ModuleOrigin origin, base::Vector<const uint8_t> wire_bytes,
+    const CompileTimeImports& compile_imports, Isolate* isolate) {
+  std::shared_ptr<NativeModule> native_module =
+      native_module_cache_.TryGetNativeModule(origin, wire_bytes,
+                                              compile_imports);
+  if (native_module) OnNativeModuleCacheHit(native_module, isolate);
+  return native_module;
+}
+
+void WasmEngine::OnNativeModuleCacheHit(
+    std::shared_ptr<NativeModule> native_module, Isolate* isolate) {
+  TRACE_EVENT0("v8.wasm", "CacheHit");
   bool remove_all_code = false;
-  if (native_module) {
-    TRACE_EVENT0("v8.wasm", "CacheHit");
+  {
     base::MutexGuard guard(&mutex_);
     auto& native_module_info = native_modules_[native_module.get()];
     if (!native_module_info) {
@@ -1632,7 +1711,6 @@ std::shared_ptr<NativeModule> WasmEngine::MaybeGetNativeModule(
     native_module->RemoveCompiledCode(
         NativeModule::RemoveFilter::kRemoveNonDebugCode);
   }
-  return native_module;
 }
 
 std::shared_ptr<NativeModule> WasmEngine::UpdateNativeModuleCache(
@@ -2144,6 +2222,14 @@ uint32_t max_mem64_pages() {
                   v8_flags.wasm_max_mem_pages.value());
 }
 
+// {memory64_guard_region_size} is declared in wasm-limits.h.
+size_t memory64_guard_region_size() {
+  if (!v8_flags.wasm_memory64_trap_handling) return 0;
+  return size_t{std::min(uint32_t{kV8MaxWasmMemory64GuardRegionMB},
+                         v8_flags.wasm_memory64_guard_region_mb.value())} *
+         MB;
+}
+
 // {max_table_init_entries} is declared in wasm-limits.h.
 uint32_t max_table_init_entries() {
   return std::min(uint32_t{kV8MaxWasmTableInitEntries},
@@ -10,6 +10,7 @@
 #define V8_WASM_WASM_ENGINE_H_
 
 #include <algorithm>
+#include <list>
 #include <map>
 #include <memory>
 #include <optional>
@@ -117,6 +118,9 @@ class NativeModuleCache {
   std::shared_ptr<NativeModule> MaybeGetNativeModule(
       ModuleOrigin origin, base::Vector<const uint8_t> wire_bytes,
       const CompileTimeImports& compile_imports);
+  std::shared_ptr<NativeModule> TryGetNativeModule(
+      ModuleOrigin origin, base::Vector<const uint8_t> wire_bytes,
+      const CompileTimeImports& compile_imports);
   bool GetStreamingCompilationOwnership(
       size_t prefix_hash, const CompileTimeImports& compile_imports);
   void StreamingCompilationFailed(size_t prefix_hash,
@@ -124,6 +128,9 @@ class NativeModuleCache {
   std::shared_ptr<NativeModule> Update(
       std::shared_ptr<NativeModule> native_module, bool error);
   void Erase(NativeModule* native_module);
+  // Drops the references to the native modules that are only kept alive by
+  // the cache (see {--wasm-native-module-cache-keep-alive}).
+  void ReleaseKeptAlive();
 
   bool empty() const { return map_.empty(); }
 
@@ -147,6 +154,18 @@ class NativeModuleCache {
   // and will soon be cleaned up from the cache.
   std::map<Key, std::optional<std::weak_ptr<NativeModule>>> map_;
 
+  // Marks {native_module} as most recently used and keeps it alive, even after
+  // all module objects referencing it died. Modules that are evicted to stay
+  // within the limit are moved to {evicted}, so that the caller can drop them
+  // after releasing {mutex_}.
+  void KeepAlive(std::shared_ptr<NativeModule> native_module,
+                 std::vector<std::shared_ptr<NativeModule>>* evicted);
+
+  // The most recently used native modules, most recent first. This allows
+  // isolates (and workers) that compile a module again after all previous
+  // users died to reuse its code, including code that got tiered up.
+  std::list<std::shared_ptr<NativeModule>> kept_alive_;
+
   base::Mutex mutex_;
 
   // This condition variable is used to synchronize threads compiling the same
@@ -240,6 +259,16 @@ class V8_EXPORT_PRIVATE WasmEngine {
   // (executable) code and the removed metadata.
   std::pair<size_t, size_t> FlushLiftoffCode();
 
+  // Releases the native modules that the native module cache keeps alive
+  // without any other user, e.g. on memory pressure.
+  void ReleaseCachedNativeModules();
+
+  // Returns whether the zone memory currently allocated via {allocator()},
+  // which is dominated by compilation, exceeds
+  // {--wasm-compile-memory-budget}. Background compilation is throttled while
+  // this is the case.
+  bool IsCompileMemoryBudgetExceeded() const;
+
   // Returns the code size of all Liftoff compiled functions in all modules.
   size_t GetLiftoffCodeSizeForTesting();
 
@@ -325,6 +354,13 @@ class V8_EXPORT_PRIVATE WasmEngine {
       ModuleOrigin origin, base::Vector<const uint8_t> wire_bytes,
       const CompileTimeImports& compile_imports, Isolate* isolate);
 
+  // Like {MaybeGetNativeModule}, but neither waits for a {NativeModule} that
+  // is currently being created nor takes ownership of its creation. This
+  // allows callers to skip work which is only needed for a new module.
+  std::shared_ptr<NativeModule> TryGetCachedNativeModule(
+      ModuleOrigin origin, base::Vector<const uint8_t> wire_bytes,
+      const CompileTimeImports& compile_imports, Isolate* isolate);
+
   // Replace the temporary {nullopt} with the new native module, or
   // erase it if any error occurred. Wake up blocked threads waiting for this
   // module.
@@ -438,6 +474,11 @@ class V8_EXPORT_PRIVATE WasmEngine {
   void EnableCodeLogging(NativeModule*);
   void DisableCodeLogging(NativeModule*);
 
+  // Register a {NativeModule} taken from the native module cache with
+  // {isolate}.
+  void OnNativeModuleCacheHit(std::shared_ptr<NativeModule> native_module,
+                              Isolate* isolate);
+
   AccountingAllocator allocator_;
 
 #ifdef V8_ENABLE_WASM_GDB_REMOTE_DEBUGGING
@@ -954,6 +954,38 @@ void array_fill_wrapper(Address raw_array, uint32_t index, uint32_t length,
   }
 }
 
+int32_t array_init_data_wrapper(Address trusted_data_addr, uint32_t seg_index,
+                                Address raw_array, uint32_t array_index,
+                                uint32_t segment_offset, uint32_t length) {
+  ThreadNotInWasmScope thread_not_in_wasm_scope;
+  DisallowGarbageCollection no_gc;
+  Tagged<WasmTrustedInstanceData> trusted_data =
+      Cast<WasmTrustedInstanceData>(Tagged<Object>{trusted_data_addr});
+  Tagged<WasmArray> array = Cast<WasmArray>(Tagged<Object>(raw_array));
+  ValueType element_type = array->type()->element_type();
+  DCHECK(element_type.is_numeric());
+  DCHECK(base::IsInBounds<uint32_t>(array_index, length, array->length()));
+
+  // No chance of overflow, because the array bounds have been checked.
+  uint32_t element_size = element_type.value_kind_size();
+  uint32_t length_in_bytes = length * element_size;
+  uint32_t seg_size = trusted_data->data_segment_sizes()->get(seg_index);
+  if (!base::IsInBounds<uint32_t>(segment_offset, length_in_bytes, seg_size)) {
+    return kOutOfBounds;
+  }
+
+  uint8_t* source = reinterpret_cast<uint8_t*>(
+                        trusted_data->data_segment_starts()->get(seg_index)) +
+                    segment_offset;
+  void* dest = ArrayElementAddress(array, array_index, element_size);
+#if V8_TARGET_BIG_ENDIAN
+  MemCopyAndSwitchEndianness(dest, source, length, element_size);
+#else
+  MemCopy(dest, source, length_in_bytes);
+#endif
+  return kSuccess;
+}
+
 double flat_string_to_f64(Address string_address) {
   Tagged<String> s = Cast<String>(Tagged<Object>(string_address));
   return FlatStringToDouble(s, ALLOW_TRAILING_JUNK,
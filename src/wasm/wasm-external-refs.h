@@ -184,6 +184,14 @@ void array_fill_wrapper(Address raw_array, uint32_t index, uint32_t length,
                         uint32_t emit_write_barrier, uint32_t raw_type,
                         Address initial_value_addr);
 
+// Copies {length} elements of the data segment {seg_index}, starting at byte
+// {segment_offset}, into the numeric array {raw_array}. Assumes that the array
+// range is in bounds. Returns 0 if the segment range is out of bounds, 1
+// otherwise.
+int32_t array_init_data_wrapper(Address trusted_data_addr, uint32_t seg_index,
+                                Address raw_array, uint32_t array_index,
+                                uint32_t segment_offset, uint32_t length);
+
 double flat_string_to_f64(Address string_address);
 
 // Update the stack limit after a stack switch,
@@ -27,7 +27,7 @@ WasmCode* WasmImportWrapperCache::ModificationScope::operator[](
 // this action is triggered by some isolate; so we use this isolate for error
 // reporting and running GCs if required.
 void WasmImportWrapperCache::LazyInitialize(Isolate* triggering_isolate) {
-  base::MutexGuard lock(&mutex_);
+  base::SharedMutexGuard<base::kExclusive> lock(&mutex_);
   if (code_allocator_.get() != nullptr) return;  // Already initialized.
   // Most wrappers are small (200-300 bytes), most modules don't need many.
   // 32K is enough for ~100 wrappers.
@@ -56,7 +56,6 @@ void WasmImportWrapperCache::LazyInitialize(Isolate* triggering_isolate) {
 
 WasmCode* WasmImportWrapperCache::ModificationScope::AddWrapper(
     const CacheKey& key, WasmCompilationResult result, WasmCode::Kind kind) {
-  cache_->mutex_.AssertHeld();
   // Equivalent of NativeModule::AddCode().
   const CodeDesc& desc = result.code_desc;
   base::Vector<uint8_t> code_space =
@@ -140,20 +139,32 @@ WasmCode* WasmImportWrapperCache::CompileWasmImportCallWrapper(
     Isolate* isolate, ImportCallKind kind, const CanonicalSig* sig,
     CanonicalTypeIndex sig_index, bool source_positions, int expected_arity,
     Suspend suspend) {
+  CacheKey key(kind, sig_index, expected_arity, suspend);
+  {
+    // Deduplicate concurrent compilations of the same wrapper: only the first
+    // thread compiles it, the others wait and then use the cached wrapper.
+    base::MutexGuard compilation_lock(&compilation_mutex_);
+    while (true) {
+      WasmCode* cached = MaybeGet(kind, sig_index, expected_arity, suspend);
+      if (cached) return cached;
+      if (keys_in_compilation_.insert(key).second) break;
+      compilation_done_.Wait(&compilation_mutex_);
+    }
+  }
   WasmCompilationResult result = compiler::CompileWasmImportCallWrapper(
       kind, sig, source_positions, expected_arity, suspend);
   WasmCode* wasm_code;
   {
     ModificationScope cache_scope(this);
-    CacheKey key(kind, sig_index, expected_arity, suspend);
-    // Now that we have the lock (in the form of the cache_scope), check
-    // again whether another thread has just created the wrapper.
-    wasm_code = cache_scope[key];
-    if (wasm_code) return wasm_code;
-
+    DCHECK_NULL(cache_scope[key]);
     wasm_code = cache_scope.AddWrapper(key, std::move(result),
                                        WasmCode::Kind::kWasmToJsWrapper);
   }
+  {
+    base::MutexGuard compilation_lock(&compilation_mutex_);
+    keys_in_compilation_.erase(key);
+    compilation_done_.NotifyAll();
+  }
 
   // To avoid lock order inversion, code printing must happen after the
   // end of the {cache_scope}.
@@ -176,7 +187,7 @@ void WasmImportWrapperCache::LogForIsolate(Isolate* isolate) {
 }
 
 void WasmImportWrapperCache::Free(std::vector<WasmCode*>& wrappers) {
-  base::MutexGuard lock(&mutex_);
+  base::SharedMutexGuard<base::kExclusive> lock(&mutex_);
   if (codes_.empty() || wrappers.empty()) return;
   // {WasmCodeAllocator::FreeCode()} wants code objects to be sorted.
   std::sort(wrappers.begin(), wrappers.end(), [](WasmCode* a, WasmCode* b) {
@@ -208,7 +219,7 @@ WasmCode* WasmImportWrapperCache::MaybeGet(ImportCallKind kind,
                                            CanonicalTypeIndex type_index,
                                            int expected_arity,
                                            Suspend suspend) const {
-  base::MutexGuard lock(&mutex_);
+  base::SharedMutexGuard<base::kShared> lock(&mutex_);
 
   auto it = entry_map_.find({kind, type_index, expected_arity, suspend});
   if (it == entry_map_.end()) return nullptr;
@@ -217,9 +228,7 @@ WasmCode* WasmImportWrapperCache::MaybeGet(ImportCallKind kind,
 }
 
 WasmCode* WasmImportWrapperCache::Lookup(Address pc) const {
-  // This can be called from the disassembler via `code->MaybePrint()` in
-  // `AddWrapper()` above, so we need a recursive mutex.
-  base::MutexGuard lock(&mutex_);
+  base::SharedMutexGuard<base::kShared> lock(&mutex_);
   auto iter = codes_.upper_bound(pc);
   if (iter == codes_.begin()) return nullptr;
   --iter;
@@ -231,8 +240,10 @@ WasmCode* WasmImportWrapperCache::Lookup(Address pc) const {
 }
 
 size_t WasmImportWrapperCache::EstimateCurrentMemoryConsumption() const {
-  UPDATE_WHEN_CLASS_CHANGES(WasmImportWrapperCache, 120);
-  base::MutexGuard lock(&mutex_);
+  UPDATE_WHEN_CLASS_CHANGES(WasmImportWrapperCache, 264);
+  base::SharedMutexGuard<base::kShared> lock(&mutex_);
+  // {keys_in_compilation_} is only non-empty while wrappers are being
+  // compiled, so it is not worth counting.
   return sizeof(WasmImportWrapperCache) + ContentSize(entry_map_) +
          ContentSize(codes_);
 }
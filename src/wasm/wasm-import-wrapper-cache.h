@@ -10,7 +10,9 @@
 #define V8_WASM_WASM_IMPORT_WRAPPER_CACHE_H_
 
 #include <unordered_map>
+#include <unordered_set>
 
+#include "src/base/platform/condition-variable.h"
 #include "src/base/platform/mutex.h"
 #include "src/wasm/module-instantiate.h"
 #include "src/wasm/wasm-code-manager.h"
@@ -52,7 +54,7 @@ class WasmImportWrapperCache {
     }
   };
 
-  // Helper class to modify the cache under a lock.
+  // Helper class to modify the cache under an exclusive lock.
   class V8_NODISCARD ModificationScope {
    public:
     explicit ModificationScope(WasmImportWrapperCache* cache)
@@ -65,7 +67,7 @@ class WasmImportWrapperCache {
 
    private:
     WasmImportWrapperCache* const cache_;
-    base::MutexGuard guard_;
+    base::SharedMutexGuard<base::kExclusive> guard_;
   };
 
   WasmImportWrapperCache() = default;
@@ -91,12 +93,16 @@ class WasmImportWrapperCache {
   // Returns nullptr if {call_target} doesn't belong to a known wrapper.
   WasmCode* FindWrapper(WasmCodePointer call_target) {
     if (call_target == kInvalidWasmCodePointer) return nullptr;
-    base::MutexGuard lock(&mutex_);
+    base::SharedMutexGuard<base::kShared> lock(&mutex_);
     auto iter = codes_.find(WasmCodePointerAddress(call_target));
     if (iter == codes_.end()) return nullptr;
     return iter->second;
   }
 
+  // Returns the cached wrapper if there is one. Otherwise compiles it, unless
+  // another thread is already compiling the same wrapper, in which case this
+  // waits for the other thread's result.
+  // Adds the returned code to the surrounding WasmCodeRefScope.
   WasmCode* CompileWasmImportCallWrapper(Isolate* isolate, ImportCallKind kind,
                                          const CanonicalSig* sig,
                                          CanonicalTypeIndex sig_index,
@@ -105,8 +111,16 @@ class WasmImportWrapperCache {
 
  private:
   std::unique_ptr<WasmCodeAllocator> code_allocator_;
-  mutable base::Mutex mutex_;
+  // Lookups vastly outnumber modifications (e.g. when many isolates
+  // instantiate modules in parallel), so they only take a shared lock.
+  mutable base::SharedMutex mutex_;
   std::unordered_map<CacheKey, WasmCode*, CacheKeyHash> entry_map_;
+  // Keys of the wrappers that are currently being compiled by
+  // {CompileWasmImportCallWrapper}. Protected by {compilation_mutex_}, which
+  // must not be acquired while holding {mutex_}.
+  base::Mutex compilation_mutex_;
+  base::ConditionVariable compilation_done_;
+  std::unordered_set<CacheKey, CacheKeyHash> keys_in_compilation_;
   // Lookup support. The map key is the instruction start address.
   std::map<Address, WasmCode*> codes_;
 };
@@ -45,6 +45,8 @@ constexpr size_t kV8MaxWasmMemory32Pages = kSystemPointerSize == 4
 constexpr size_t kV8MaxWasmMemory64Pages = kSystemPointerSize == 4
                                                ? 32'767    // = 2 GiB - 64Kib
                                                : 262'144;  // = 16 GiB
+// Guard region reserved behind memory64 memories that use trap handling.
+constexpr uint32_t kV8MaxWasmMemory64GuardRegionMB = 1024;
 constexpr size_t kV8MaxWasmStringSize = 100'000;
 constexpr size_t kV8MaxWasmModuleSize = 1024 * 1024 * 1024;  // = 1 GiB
 constexpr size_t kV8MaxWasmFunctionSize = 7'654'321;
@@ -101,6 +103,10 @@ inline uint64_t max_mem64_bytes() {
   return uint64_t{max_mem64_pages()} * kWasmPageSize;
 }
 
+// Size of the inaccessible region reserved behind a memory64 memory that uses
+// trap handling, or 0 if memory64 does not use trap handling.
+V8_EXPORT_PRIVATE size_t memory64_guard_region_size();
+
 V8_EXPORT_PRIVATE uint32_t max_table_init_entries();
 V8_EXPORT_PRIVATE size_t max_module_size();
 
@@ -148,6 +148,19 @@ struct WasmMemory {
   BoundsCheckStrategy bounds_checks = kExplicitBoundsChecks;
 
   bool is_memory64() const { return address_type == AddressType::kI64; }
+
+  // Exclusive upper limit of the index of a memory64 access that is protected
+  // by the trap handler, with {end_offset} being the offset of the last
+  // accessed byte. Accesses whose end offset falls into the guard region
+  // behind the memory only check the index itself, so that all accesses with
+  // the same index use the same check.
+  uint64_t trap_handler_index_limit(uintptr_t end_offset) const {
+    DCHECK(is_memory64());
+    DCHECK_EQ(kTrapHandler, bounds_checks);
+    DCHECK_LT(end_offset, max_memory_size);
+    if (end_offset < memory64_guard_region_size()) return max_memory_size;
+    return max_memory_size - end_offset;
+  }
 };
 
 inline void UpdateComputedInformation(WasmMemory* memory, ModuleOrigin origin) {
@@ -9,6 +9,7 @@
 #include "src/debug/debug.h"
 #include "src/runtime/runtime.h"
 #include "src/snapshot/snapshot-data.h"
+#include "src/tracing/trace-event.h"
 #include "src/utils/ostreams.h"
 #include "src/utils/version.h"
 #include "src/wasm/code-space-access.h"
@@ -314,6 +315,8 @@ class V8_EXPORT_PRIVATE NativeModuleSerializer {
 
  private:
   size_t MeasureCode(const WasmCode*) const;
+  const DeferredDeserializedCode::Unit* DeferredUnit(
+      size_t declared_index) const;
   void WriteHeader(Writer*, size_t total_code_size);
   void WriteCode(const WasmCode*, Writer*,
                  const NativeModule::CallIndirectTargetMap&);
@@ -365,8 +368,10 @@ size_t NativeModuleSerializer::Measure() const {
                 import_statuses_.size() * sizeof(WellKnownImport);
 
   // From {WriteCode}, called repeatedly.
-  for (WasmCode* code : code_table_) {
-    size += MeasureCode(code);
+  for (size_t i = 0; i < code_table_.size(); ++i) {
+    const DeferredDeserializedCode::Unit* deferred_unit = DeferredUnit(i);
+    size += deferred_unit ? deferred_unit->serialized_code.size()
+                          : MeasureCode(code_table_[i]);
   }
 
   // Tiering budget, wrote in {Write} directly.
@@ -375,6 +380,19 @@ size_t NativeModuleSerializer::Measure() const {
   return size;
 }
 
+// Functions whose deserialization was deferred (see
+// --wasm-lazy-deserialization) and which were not called yet have no code in
+// the code table, but their serialized code must not be dropped.
+const DeferredDeserializedCode::Unit* NativeModuleSerializer::DeferredUnit(
+    size_t declared_index) const {
+  if (code_table_[declared_index] != nullptr) return nullptr;
+  DeferredDeserializedCode* deferred_code =
+      native_module_->deferred_deserialized_code();
+  if (deferred_code == nullptr) return nullptr;
+  return deferred_code->Find(native_module_->num_imported_functions() +
+                             static_cast<int>(declared_index));
+}
+
 void NativeModuleSerializer::WriteHeader(Writer* writer,
                                          size_t total_code_size) {
   // TODO(eholk): We need to properly preserve the flag whether the trap
@@ -596,18 +614,31 @@ bool NativeModuleSerializer::Write(Writer* writer) {
   write_called_ = true;
 
   size_t total_code_size = 0;
-  for (WasmCode* code : code_table_) {
+  for (size_t i = 0; i < code_table_.size(); ++i) {
+    WasmCode* code = code_table_[i];
     if (code && code->tier() == ExecutionTier::kTurbofan) {
       DCHECK(IsAligned(code->instructions().size(), kCodeAlignment));
       total_code_size += code->instructions().size();
+    } else if (const DeferredDeserializedCode::Unit* deferred_unit =
+                   DeferredUnit(i)) {
+      total_code_size += deferred_unit->src_code_buffer.size();
     }
   }
   WriteHeader(writer, total_code_size);
 
   NativeModule::CallIndirectTargetMap function_index_map =
       native_module_->CreateIndirectCallTargetToFunctionIndexMap();
-  for (WasmCode* code : code_table_) {
-    WriteCode(code, writer, function_index_map);
+  for (size_t i = 0; i < code_table_.size(); ++i) {
+    if (const DeferredDeserializedCode::Unit* deferred_unit =
+            DeferredUnit(i)) {
+      // The serialized code of a deferred function is position-independent
+      // and can be written again as is.
+      ++num_turbofan_functions_;
+      writer->WriteVector(deferred_unit->serialized_code);
+      total_written_code_ += deferred_unit->src_code_buffer.size();
+      continue;
+    }
+    WriteCode(code_table_[i], writer, function_index_map);
   }
   // No TurboFan-compiled functions in jitless mode.
   if (!v8_flags.wasm_jitless) {
@@ -694,7 +725,10 @@ class DeserializationQueue {
 
 class V8_EXPORT_PRIVATE NativeModuleDeserializer {
  public:
-  explicit NativeModuleDeserializer(NativeModule*);
+  // If {deferred_code} is not {nullptr}, the reader must point into its
+  // serialized module, and code is added to it instead of being relocated.
+  NativeModuleDeserializer(NativeModule*,
+                           DeferredDeserializedCode* deferred_code);
   NativeModuleDeserializer(const NativeModuleDeserializer&) = delete;
   NativeModuleDeserializer& operator=(const NativeModuleDeserializer&) = delete;
 
@@ -710,11 +744,13 @@ class V8_EXPORT_PRIVATE NativeModuleDeserializer {
 
  private:
   friend class DeserializeCodeTask;
+  friend WasmCode* MaterializeDeserializedCode(NativeModule*, int);
 
   void ReadHeader(Reader* reader);
   DeserializationUnit ReadCode(int fn_index, Reader* reader);
   void ReadTieringBudget(Reader* reader);
-  void CopyAndRelocate(const DeserializationUnit& unit);
+  static void CopyAndRelocate(NativeModule* native_module,
+                              const DeserializationUnit& unit);
   void Publish(std::vector<DeserializationUnit> batch);
 
   NativeModule* const native_module_;
@@ -730,6 +766,7 @@ class V8_EXPORT_PRIVATE NativeModuleDeserializer {
   NativeModule::JumpTablesRef current_jump_tables_;
   std::vector<int> lazy_functions_;
   std::vector<int> eager_functions_;
+  DeferredDeserializedCode* const deferred_code_;
 };
 
 class DeserializeCodeTask : public JobTask {
@@ -747,7 +784,8 @@ class DeserializeCodeTask : public JobTask {
       auto batch = reloc_queue_->Pop();
       if (batch.empty()) break;
       for (const auto& unit : batch) {
-        deserializer_->CopyAndRelocate(unit);
+        NativeModuleDeserializer::CopyAndRelocate(
+            deserializer_->native_module_, unit);
       }
       publish_queue_.Add(std::move(batch));
       delegate->NotifyConcurrencyIncrease();
@@ -793,8 +831,9 @@ class DeserializeCodeTask : public JobTask {
   std::atomic<bool> publishing_{false};
 };
 
-NativeModuleDeserializer::NativeModuleDeserializer(NativeModule* native_module)
-    : native_module_(native_module) {}
+NativeModuleDeserializer::NativeModuleDeserializer(
+    NativeModule* native_module, DeferredDeserializedCode* deferred_code)
+    : native_module_(native_module), deferred_code_(deferred_code) {}
 
 bool NativeModuleDeserializer::Read(Reader* reader) {
   DCHECK(!read_called_);
@@ -833,8 +872,22 @@ bool NativeModuleDeserializer::Read(Reader* reader) {
   std::vector<DeserializationUnit> batch;
   size_t batch_size = 0;
   for (uint32_t i = first_wasm_fn; i < total_fns; ++i) {
+    const uint8_t* serialized_code_start = reader->current_location();
     DeserializationUnit unit = ReadCode(i, reader);
     if (!unit.code) continue;
+    if (deferred_code_) {
+      // The jump table keeps pointing to the lazy compile stub until the
+      // function is called.
+      DeferredDeserializedCode::Unit& deferred_unit = deferred_code_->Add(i);
+      deferred_unit.serialized_code = base::VectorOf(
+          serialized_code_start,
+          reader->current_location() - serialized_code_start);
+      deferred_unit.src_code_buffer = unit.src_code_buffer;
+      deferred_unit.jump_tables = unit.jump_tables;
+      deferred_unit.code = std::move(unit.code);
+      lazy_functions_.push_back(i);
+      continue;
+    }
     batch_size += unit.code->instructions().size();
     batch.emplace_back(std::move(unit));
     if (batch_size >= batch_limit) {
@@ -960,8 +1013,9 @@ DeserializationUnit NativeModuleDeserializer::ReadCode(int fn_index,
   return unit;
 }
 
+// static
 void NativeModuleDeserializer::CopyAndRelocate(
-    const DeserializationUnit& unit) {
+    NativeModule* native_module, const DeserializationUnit& unit) {
   WritableJitAllocation jit_allocation = ThreadIsolation::RegisterJitAllocation(
       reinterpret_cast<Address>(unit.code->instructions().begin()),
       unit.code->instructions().size(),
@@ -987,13 +1041,13 @@ void NativeModuleDeserializer::CopyAndRelocate(
       case RelocInfo::WASM_CALL: {
         uint32_t tag = GetWasmCalleeTag(iter.rinfo());
         Address target =
-            native_module_->GetNearCallTargetForFunction(tag, unit.jump_tables);
+            native_module->GetNearCallTargetForFunction(tag, unit.jump_tables);
         iter.rinfo()->set_wasm_call_address(target);
         break;
       }
       case RelocInfo::WASM_STUB_CALL: {
         uint32_t tag = GetWasmCalleeTag(iter.rinfo());
-        Address target = native_module_->GetJumpTableEntryForBuiltin(
+        Address target = native_module->GetJumpTableEntryForBuiltin(
             static_cast<Builtin>(tag), unit.jump_tables);
         iter.rinfo()->set_wasm_stub_call_address(target);
         break;
@@ -1007,12 +1061,12 @@ void NativeModuleDeserializer::CopyAndRelocate(
         ModuleTypeIndex module_local_sig_id{
             iter.rinfo()->wasm_canonical_sig_id()};
         CanonicalTypeIndex canonical_sig_id =
-            native_module_->module()->canonical_sig_id(module_local_sig_id);
+            native_module->module()->canonical_sig_id(module_local_sig_id);
         iter.rinfo()->set_wasm_canonical_sig_id(canonical_sig_id.index);
       } break;
       case RelocInfo::WASM_INDIRECT_CALL_TARGET: {
         Address function_index = iter.rinfo()->wasm_indirect_call_target();
-        WasmCodePointer target = native_module_->GetIndirectCallTarget(
+        WasmCodePointer target = native_module->GetIndirectCallTarget(
             base::checked_cast<uint32_t>(function_index));
         iter.rinfo()->set_wasm_indirect_call_target(target, SKIP_ICACHE_FLUSH);
       } break;
@@ -1067,6 +1121,31 @@ void NativeModuleDeserializer::Publish(std::vector<DeserializationUnit> batch) {
   }
 }
 
+WasmCode* MaterializeDeserializedCode(NativeModule* native_module,
+                                     int func_index) {
+  DeferredDeserializedCode* deferred_code =
+      native_module->deferred_deserialized_code();
+  if (deferred_code == nullptr) return nullptr;
+  DeferredDeserializedCode::Unit* deferred_unit =
+      deferred_code->Find(func_index);
+  if (deferred_unit == nullptr) return nullptr;
+  base::MutexGuard guard(&deferred_unit->mutex);
+  // Another thread materialized this function while we were waiting for the
+  // mutex.
+  if (!deferred_unit->code) return native_module->GetCode(func_index);
+
+  TRACE_EVENT1("v8.wasm", "wasm.MaterializeDeserializedCode", "func_index",
+               func_index);
+  DeserializationUnit unit{deferred_unit->src_code_buffer,
+                           std::move(deferred_unit->code),
+                           deferred_unit->jump_tables};
+  NativeModuleDeserializer::CopyAndRelocate(native_module, unit);
+  WasmCode* code = native_module->PublishCode(std::move(unit.code));
+  code->MaybePrint();
+  code->Validate();
+  return code;
+}
+
 bool IsSupportedVersion(base::Vector<const uint8_t> header,
                         WasmEnabledFeatures enabled_features) {
   if (header.size() < WasmSerializer::kHeaderSize) return false;
@@ -1077,16 +1156,15 @@ bool IsSupportedVersion(base::Vector<const uint8_t> header,
          0;
 }
 
-MaybeHandle<WasmModuleObject> DeserializeNativeModule(
-    Isolate* isolate, base::Vector<const uint8_t> data,
-    base::Vector<const uint8_t> wire_bytes_vec,
-    const CompileTimeImports& compile_imports,
-    base::Vector<const char> source_url) {
-  WasmEnabledFeatures enabled_features =
-      WasmEnabledFeatures::FromIsolate(isolate);
-  if (!IsWasmCodegenAllowed(isolate, isolate->native_context())) return {};
-  if (!IsSupportedVersion(data, enabled_features)) return {};
+namespace {
 
+// Deserializes {data} into a new {NativeModule}, unless another thread
+// created one for the same wire bytes in the meantime.
+std::shared_ptr<NativeModule> DeserializeNewNativeModule(
+    Isolate* isolate, WasmEnabledFeatures enabled_features,
+    base::Vector<const uint8_t> data,
+    base::Vector<const uint8_t> wire_bytes_vec,
+    const CompileTimeImports& compile_imports) {
   // Make the copy of the wire bytes early, so we use the same memory for
   // decoding, lookup in the native module cache, and insertion into the cache.
   auto owned_wire_bytes = base::OwnedVector<uint8_t>::Of(wire_bytes_vec);
@@ -1121,7 +1199,15 @@ MaybeHandle<WasmModuleObject> DeserializeNativeModule(
     shared_native_module->compilation_state()->set_compilation_id(-2);
     shared_native_module->SetWireBytes(std::move(owned_wire_bytes));
 
-    NativeModuleDeserializer deserializer(shared_native_module.get());
+    // Deferred functions point into the serialized module, so copy it once
+    // and read from the copy.
+    std::unique_ptr<DeferredDeserializedCode> deferred_code;
+    if (v8_flags.wasm_lazy_deserialization) {
+      deferred_code = std::make_unique<DeferredDeserializedCode>(data);
+      data = deferred_code->serialized_module();
+    }
+    NativeModuleDeserializer deserializer(shared_native_module.get(),
+                                          deferred_code.get());
     Reader reader(data + WasmSerializer::kHeaderSize);
     bool error = !deserializer.Read(&reader);
     if (error) {
@@ -1129,6 +1215,10 @@ MaybeHandle<WasmModuleObject> DeserializeNativeModule(
           error, std::move(shared_native_module), isolate);
       return {};
     }
+    if (deferred_code) {
+      shared_native_module->set_deferred_deserialized_code(
+          std::move(deferred_code));
+    }
     shared_native_module->compilation_state()->InitializeAfterDeserialization(
         deserializer.lazy_functions(), deserializer.eager_functions());
     wasm_engine->UpdateNativeModuleCache(error, shared_native_module, isolate);
@@ -1139,6 +1229,34 @@ MaybeHandle<WasmModuleObject> DeserializeNativeModule(
     PublishDetectedFeatures(detected_features, isolate, true);
   }
 
+  return shared_native_module;
+}
+
+}  // namespace
+
+MaybeHandle<WasmModuleObject> DeserializeNativeModule(
+    Isolate* isolate, base::Vector<const uint8_t> data,
+    base::Vector<const uint8_t> wire_bytes_vec,
+    const CompileTimeImports& compile_imports,
+    base::Vector<const char> source_url) {
+  WasmEnabledFeatures enabled_features =
+      WasmEnabledFeatures::FromIsolate(isolate);
+  if (!IsWasmCodegenAllowed(isolate, isolate->native_context())) return {};
+  if (!IsSupportedVersion(data, enabled_features)) return {};
+
+  // Isolates deserializing the same module share one {NativeModule}. Check
+  // for it before copying and decoding the wire bytes, which for large
+  // modules is a significant part of the work.
+  WasmEngine* wasm_engine = GetWasmEngine();
+  std::shared_ptr<NativeModule> shared_native_module =
+      wasm_engine->TryGetCachedNativeModule(kWasmOrigin, wire_bytes_vec,
+                                            compile_imports, isolate);
+  if (shared_native_module == nullptr) {
+    shared_native_module = DeserializeNewNativeModule(
+        isolate, enabled_features, data, wire_bytes_vec, compile_imports);
+    if (shared_native_module == nullptr) return {};
+  }
+
   DirectHandle<Script> script =
       wasm_engine->GetOrCreateScript(isolate, shared_native_module, source_url);
   Handle<WasmModuleObject> module_object =
@@ -9,6 +9,10 @@
 #ifndef V8_WASM_WASM_SERIALIZATION_H_
 #define V8_WASM_WASM_SERIALIZATION_H_
 
+#include <unordered_map>
+
+#include "src/base/platform/mutex.h"
+#include "src/base/vector.h"
 #include "src/wasm/wasm-code-manager.h"
 #include "src/wasm/wasm-objects.h"
 
@@ -64,6 +68,62 @@ V8_EXPORT_PRIVATE MaybeHandle<WasmModuleObject> DeserializeNativeModule(
     const CompileTimeImports& compile_imports,
     base::Vector<const char> source_url);
 
+// Copies, relocates and publishes the deferred code for {func_index}. Returns
+// {nullptr} if there is no deferred code for that function. Requires a
+// {WasmCodeRefScope}.
+V8_EXPORT_PRIVATE WasmCode* MaterializeDeserializedCode(NativeModule*,
+                                                        int func_index);
+
+// Code which was read during deserialization, but whose copying into the code
+// space and relocation is deferred until the function is called for the first
+// time (see --wasm-lazy-deserialization). Until then, the jump table slot of
+// the function points to the lazy compile stub.
+//
+// The units point into a single copy of the serialized module, which is
+// kept alive for the lifetime of the {NativeModule}. The memory cost of the
+// flag is hence the size of the serialized module.
+class DeferredDeserializedCode {
+ public:
+  struct Unit {
+    // The serialized record of the function, written again unchanged if the
+    // module is re-serialized before the function was called.
+    base::Vector<const uint8_t> serialized_code;
+    // The unrelocated instructions within {serialized_code}.
+    base::Vector<const uint8_t> src_code_buffer;
+    NativeModule::JumpTablesRef jump_tables;
+    // Guards {code}, so that only calls of the same function wait for each
+    // other. {nullptr} once materialized.
+    base::Mutex mutex;
+    std::unique_ptr<WasmCode> code;
+  };
+
+  explicit DeferredDeserializedCode(
+      base::Vector<const uint8_t> serialized_module)
+      : serialized_module_(
+            base::OwnedVector<uint8_t>::Of(serialized_module)) {}
+
+  base::Vector<const uint8_t> serialized_module() const {
+    return serialized_module_.as_vector();
+  }
+
+  // Only called during deserialization, before the module is shared.
+  Unit& Add(int func_index) {
+    DCHECK_EQ(0, units_.count(func_index));
+    return units_[func_index];
+  }
+
+  // Materialized units stay in the map, so that the returned pointer is
+  // stable and the lookup needs no lock.
+  Unit* Find(int func_index) {
+    auto it = units_.find(func_index);
+    return it == units_.end() ? nullptr : &it->second;
+  }
+
+ private:
+  const base::OwnedVector<const uint8_t> serialized_module_;
+  std::unordered_map<int, Unit> units_;
+};
+
 }  // namespace v8::internal::wasm
 
 #endif  // V8_WASM_WASM_SERIALIZATION_H_
@@ -87,6 +87,28 @@ enum class WellKnownImport : uint8_t {
   kStringToLocaleLowerCaseStringref,
   kStringToLowerCaseStringref,
   kStringToLowerCaseImported,
+
+  // Math functions that map directly to machine operators:
+  kMathAbs,
+  kMathAcos,
+  kMathAsin,
+  kMathAtan,
+  kMathAtan2,
+  kMathCeil,
+  kMathClz32,
+  kMathCos,
+  kMathExp,
+  kMathFloor,
+  kMathImul,
+  kMathLog,
+  kMathMax,
+  kMathMin,
+  kMathPow,
+  kMathSin,
+  kMathSqrt,
+  kMathTan,
+  kMathTrunc,
+
   // Fast API calls:
   kFastAPICall,
 };
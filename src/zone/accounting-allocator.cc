@@ -25,6 +25,11 @@ namespace {
 
 static constexpr size_t kZonePageSize = 256 * KB;
 
+// Only segments up to the maximum regular segment size of a {Zone} are pooled;
+// bigger segments are allocated for individual large allocations and are
+// unlikely to be reused.
+static constexpr size_t kMaxPooledSegmentSize = 32 * KB;
+
 VirtualMemory ReserveAddressSpace(v8::PageAllocator* platform_allocator) {
   DCHECK(IsAligned(ZoneCompression::kReservationSize,
                    platform_allocator->AllocatePageSize()));
@@ -75,7 +80,60 @@ AccountingAllocator::AccountingAllocator() {
   }
 }
 
-AccountingAllocator::~AccountingAllocator() = default;
+AccountingAllocator::~AccountingAllocator() { ReleasePooledSegments(); }
+
+void AccountingAllocator::ConfigureSegmentPool(size_t max_pooled_bytes) {
+  max_pooled_memory_.store(max_pooled_bytes, std::memory_order_relaxed);
+  if (max_pooled_bytes == 0) ReleasePooledSegments();
+}
+
+void AccountingAllocator::ReleasePooledSegments() {
+  Segment* segment;
+  {
+    base::MutexGuard guard(&pool_mutex_);
+    segment = pool_head_;
+    pool_head_ = nullptr;
+    pooled_memory_.store(0, std::memory_order_relaxed);
+  }
+  while (segment != nullptr) {
+    Segment* next = segment->next();
+    segment->ZapHeader();
+    free(segment);
+    segment = next;
+  }
+}
+
+Segment* AccountingAllocator::TryGetPooledSegment(size_t bytes) {
+  if (pooled_memory_.load(std::memory_order_relaxed) == 0) return nullptr;
+  base::MutexGuard guard(&pool_mutex_);
+  // Take the first segment that is big enough, but don't waste pooled
+  // segments which are much bigger than requested.
+  for (Segment** link = &pool_head_; *link != nullptr;
+       link = &(*link)->next_) {
+    Segment* segment = *link;
+    size_t size = segment->total_size();
+    if (size < bytes || size > 2 * bytes) continue;
+    *link = segment->next();
+    pooled_memory_.fetch_sub(size, std::memory_order_relaxed);
+    return segment;
+  }
+  return nullptr;
+}
+
+bool AccountingAllocator::TryPoolSegment(Segment* segment) {
+  size_t size = segment->total_size();
+  if (size > kMaxPooledSegmentSize) return false;
+  size_t max_pooled = max_pooled_memory_.load(std::memory_order_relaxed);
+  if (max_pooled == 0) return false;
+  base::MutexGuard guard(&pool_mutex_);
+  size_t pooled = pooled_memory_.load(std::memory_order_relaxed);
+  if (pooled + size > max_pooled) return false;
+  segment->set_zone(nullptr);
+  segment->set_next(pool_head_);
+  pool_head_ = segment;
+  pooled_memory_.store(pooled + size, std::memory_order_relaxed);
+  return true;
+}
 
 Segment* AccountingAllocator::AllocateSegment(size_t bytes,
                                               bool supports_compression) {
@@ -85,6 +143,9 @@ Segment* AccountingAllocator::AllocateSegment(size_t bytes,
     memory = AllocatePages(bounded_page_allocator_.get(), nullptr, bytes,
                            kZonePageSize, PageAllocator::kReadWrite);
 
+  } else if (Segment* pooled = TryGetPooledSegment(bytes)) {
+    memory = pooled;
+    bytes = pooled->total_size();
   } else {
     auto result = AllocAtLeastWithRetry(bytes);
     memory = result.ptr;
@@ -108,6 +169,10 @@ void AccountingAllocator::ReturnSegment(Segment* segment,
   segment->ZapContents();
   size_t segment_size = segment->total_size();
   current_memory_usage_.fetch_sub(segment_size, std::memory_order_relaxed);
+  if (!(COMPRESS_ZONES_BOOL && supports_compression) &&
+      TryPoolSegment(segment)) {
+    return;
+  }
   segment->ZapHeader();
   if (COMPRESS_ZONES_BOOL && supports_compression) {
     FreePages(bounded_page_allocator_.get(), segment, segment_size);
@@ -10,6 +10,7 @@
 
 #include "include/v8-platform.h"
 #include "src/base/macros.h"
+#include "src/base/platform/mutex.h"
 #include "src/logging/tracing-flags.h"
 
 namespace v8 {
@@ -46,6 +47,20 @@ class V8_EXPORT_PRIVATE AccountingAllocator {
     return max_memory_usage_.load(std::memory_order_relaxed);
   }
 
+  // Keep up to {max_pooled_bytes} of returned small segments for reuse by
+  // later allocations instead of freeing them immediately. This avoids
+  // malloc/free churn for users which create many short-lived zones, like
+  // Wasm compilation jobs. Pooled segments are not included in
+  // {GetCurrentMemoryUsage()}.
+  void ConfigureSegmentPool(size_t max_pooled_bytes);
+
+  // Free all pooled segments, e.g. on memory pressure.
+  void ReleasePooledSegments();
+
+  size_t GetPooledMemory() const {
+    return pooled_memory_.load(std::memory_order_relaxed);
+  }
+
   void TraceZoneCreation(const Zone* zone) {
     if (V8_LIKELY(!TracingFlags::is_zone_stats_enabled())) return;
     TraceZoneCreationImpl(zone);
@@ -67,9 +82,18 @@ class V8_EXPORT_PRIVATE AccountingAllocator {
   virtual void TraceAllocateSegmentImpl(Segment* segment) {}
 
  private:
+  Segment* TryGetPooledSegment(size_t bytes);
+  bool TryPoolSegment(Segment* segment);
+
   std::atomic<size_t> current_memory_usage_{0};
   std::atomic<size_t> max_memory_usage_{0};
 
+  std::atomic<size_t> max_pooled_memory_{0};
+  std::atomic<size_t> pooled_memory_{0};
+  base::Mutex pool_mutex_;
+  // Singly-linked list of pooled segments, protected by {pool_mutex_}.
+  Segment* pool_head_ = nullptr;
+
   std::unique_ptr<VirtualMemory> reserved_area_;
   std::unique_ptr<base::BoundedPageAllocator> bounded_page_allocator_;
 };
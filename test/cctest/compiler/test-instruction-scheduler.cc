@@ -2,11 +2,15 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 
+#include <set>
+#include <vector>
+
 #include "src/compiler/backend/instruction-scheduler.h"
 #include "src/compiler/backend/instruction-selector-impl.h"
 #include "src/compiler/backend/instruction-selector.h"
 #include "src/compiler/backend/instruction.h"
 #include "test/cctest/cctest.h"
+#include "test/common/flag-utils.h"
 
 namespace v8 {
 namespace internal {
@@ -35,7 +39,15 @@ class InstructionSchedulerTester {
 
   void StartBlock() { scheduler_.StartBlock(RpoNumber::FromInt(0)); }
   void EndBlock() { scheduler_.EndBlock(RpoNumber::FromInt(0)); }
-  void AddInstruction(Instruction* instr) { scheduler_.AddInstruction(instr); }
+  void AddInstruction(Instruction* instr) {
+    scheduler_.AddInstruction(instr);
+    // Keep the nodes around, so that issue cycles can be checked after the
+    // block was scheduled. Barriers don't get a node.
+    if (!scheduler_.graph_.empty() &&
+        scheduler_.graph_.back()->instruction() == instr) {
+      nodes_.push_back(scheduler_.graph_.back());
+    }
+  }
   void AddTerminator(Instruction* instr) { scheduler_.AddTerminator(instr); }
 
   void CheckHasSideEffect(Instruction* instr) {
@@ -53,6 +65,41 @@ class InstructionSchedulerTester {
              successors.end());
   }
 
+  // Create an instruction defining a fresh virtual register and using the
+  // registers defined by {inputs}.
+  Instruction* NewInstruction(InstructionCode opcode,
+                              std::initializer_list<Instruction*> inputs = {}) {
+    InstructionOperand output =
+        UnallocatedOperand(UnallocatedOperand::MUST_HAVE_REGISTER,
+                           sequence_.NextVirtualRegister());
+    std::vector<InstructionOperand> input_operands;
+    for (Instruction* input : inputs) {
+      input_operands.push_back(UnallocatedOperand(
+          UnallocatedOperand::MUST_HAVE_REGISTER,
+          UnallocatedOperand::cast(input->OutputAt(0))->virtual_register()));
+    }
+    return Instruction::New(zone(), opcode, 1, &output, input_operands.size(),
+                            input_operands.data(), 0, nullptr);
+  }
+
+  // The cycle {instr} was issued in. Only valid after the block was scheduled.
+  int IssueCycle(Instruction* instr) {
+    for (auto node : nodes_) {
+      if (node->instruction() == instr) return node->start_cycle();
+    }
+    UNREACHABLE();
+  }
+
+  // The position of {instr} in the scheduled instruction sequence.
+  int Position(Instruction* instr) {
+    int position = 0;
+    for (Instruction* scheduled : sequence_.instructions()) {
+      if (scheduled == instr) return position;
+      position++;
+    }
+    UNREACHABLE();
+  }
+
   Zone* zone() { return scope_.main_zone(); }
 
  private:
@@ -67,6 +114,7 @@ class InstructionSchedulerTester {
   InstructionBlocks* blocks_;
   InstructionSequence sequence_;
   InstructionScheduler scheduler_;
+  std::vector<InstructionScheduler::ScheduleGraphNode*> nodes_;
 };
 
 TEST(DeoptInMiddleOfBasicBlock) {
@@ -107,6 +155,103 @@ TEST(DeoptInMiddleOfBasicBlock) {
   tester.EndBlock();
 }
 
+TEST(CpuModelForX64) {
+  using Model = SchedulerCpuModel;
+  CHECK_EQ(Model::kIntelSkylake,
+           InstructionScheduler::CpuModelForX64("GenuineIntel", 0x6, 0x5E));
+  CHECK_EQ(Model::kIntelSkylake,
+           InstructionScheduler::CpuModelForX64("GenuineIntel", 0x6, 0x9E));
+  CHECK_EQ(Model::kIntelSkylake,
+           InstructionScheduler::CpuModelForX64("GenuineIntel", 0x6, 0x97));
+  // Haswell, Goldmont and unknown family-6 models use the generic model.
+  CHECK_EQ(Model::kGeneric,
+           InstructionScheduler::CpuModelForX64("GenuineIntel", 0x6, 0x3C));
+  CHECK_EQ(Model::kGeneric,
+           InstructionScheduler::CpuModelForX64("GenuineIntel", 0x6, 0x5C));
+  CHECK_EQ(Model::kGeneric,
+           InstructionScheduler::CpuModelForX64("GenuineIntel", 0x6, 0xFF));
+  CHECK_EQ(Model::kGeneric,
+           InstructionScheduler::CpuModelForX64("GenuineIntel", 0xF, 0x4));
+  CHECK_EQ(Model::kAmdZen,
+           InstructionScheduler::CpuModelForX64("AuthenticAMD", 0x17, 0x1));
+  CHECK_EQ(Model::kAmdZen,
+           InstructionScheduler::CpuModelForX64("AuthenticAMD", 0x19, 0x21));
+  CHECK_EQ(Model::kGeneric,
+           InstructionScheduler::CpuModelForX64("AuthenticAMD", 0x15, 0x2));
+  CHECK_EQ(Model::kGeneric,
+           InstructionScheduler::CpuModelForX64("SomeOtherVendor", 0x6, 0x5E));
+}
+
+#if V8_TARGET_ARCH_X64
+
+// Two multiplications and two additions depending on them, plus two
+// independent additions.
+struct SmallGraph {
+  explicit SmallGraph(InstructionSchedulerTester* tester)
+      : mul1(tester->NewInstruction(kX64Imul)),
+        mul2(tester->NewInstruction(kX64Imul)),
+        use1(tester->NewInstruction(kX64Add, {mul1})),
+        use2(tester->NewInstruction(kX64Add, {mul2})),
+        add1(tester->NewInstruction(kX64Add)),
+        add2(tester->NewInstruction(kX64Add)),
+        ret(Instruction::New(tester->zone(), kArchRet)) {
+    tester->StartBlock();
+    for (Instruction* instr : {mul1, mul2, use1, use2, add1, add2}) {
+      tester->AddInstruction(instr);
+    }
+    tester->AddTerminator(ret);
+    tester->EndBlock();
+  }
+
+  Instruction* mul1;
+  Instruction* mul2;
+  Instruction* use1;
+  Instruction* use2;
+  Instruction* add1;
+  Instruction* add2;
+  Instruction* ret;
+};
+
+TEST(GenericModelIssuesOneInstructionPerCycle) {
+  FlagScope<const char*> cpu(&v8_flags.turbo_instruction_scheduling_cpu,
+                             "generic");
+  InstructionSchedulerTester tester;
+  SmallGraph graph(&tester);
+
+  std::set<int> cycles;
+  for (Instruction* instr : {graph.mul1, graph.mul2, graph.use1, graph.use2,
+                             graph.add1, graph.add2}) {
+    CHECK(cycles.insert(tester.IssueCycle(instr)).second);
+  }
+  // The multiplications are on the critical path and go first.
+  CHECK_EQ(0, tester.Position(graph.mul1));
+  CHECK_EQ(1, tester.Position(graph.mul2));
+}
+
+TEST(SkylakeModelGroupsIssueByExecutionUnit) {
+  FlagScope<const char*> cpu(&v8_flags.turbo_instruction_scheduling_cpu,
+                             "skylake");
+  InstructionSchedulerTester tester;
+  SmallGraph graph(&tester);
+
+  // Only one multiplier is modelled, so the second multiplication has to wait
+  // for the next cycle, while the independent additions fill the first one.
+  CHECK_EQ(0, tester.IssueCycle(graph.mul1));
+  CHECK_EQ(0, tester.IssueCycle(graph.add1));
+  CHECK_EQ(0, tester.IssueCycle(graph.add2));
+  CHECK_EQ(1, tester.IssueCycle(graph.mul2));
+  // Uses wait for the 3-cycle latency of the multiplication they depend on.
+  CHECK_EQ(3, tester.IssueCycle(graph.use1));
+  CHECK_EQ(4, tester.IssueCycle(graph.use2));
+
+  CHECK_EQ(0, tester.Position(graph.mul1));
+  CHECK_LT(tester.Position(graph.add1), tester.Position(graph.mul2));
+  CHECK_LT(tester.Position(graph.add2), tester.Position(graph.mul2));
+  CHECK_EQ(6, tester.Position(graph.ret));
+}
+
+#endif  // V8_TARGET_ARCH_X64
+
 }  // namespace compiler
 }  // namespace internal
 }  // namespace v8
@@ -21111,6 +21111,68 @@ THREADED_TEST(JSONParseArray) {
                      i::PACKED_ELEMENTS);
 }
 
+namespace {
+// Feeds {input} to a streaming parser in chunks of {chunk_size} bytes.
+v8::MaybeLocal<Value> StreamingParseJSON(Local<Context> context,
+                                         const char* input,
+                                         size_t chunk_size) {
+  v8::JSON::StreamingParser parser(context->GetIsolate());
+  const uint8_t* data = reinterpret_cast<const uint8_t*>(input);
+  size_t length = strlen(input);
+  for (size_t offset = 0; offset < length; offset += chunk_size) {
+    if (parser.Write(context, data + offset,
+                     std::min(chunk_size, length - offset))
+            .IsNothing()) {
+      return {};
+    }
+  }
+  return parser.Finish(context);
+}
+}  // namespace
+
+THREADED_TEST(JSONStreamingParse) {
+  LocalContext context;
+  HandleScope scope(context->GetIsolate());
+  const char* kCases[][2] = {
+      {"[]", "[]"},
+      {" [ ] ", "[]"},
+      {"[1, 2.5, \"a,]\\\"\", null]", "[1,2.5,\"a,]\\\"\",null]"},
+      {"[{\"a\": [1, {\"b\": \"]}\"}]}, [[], {}], true]",
+       "[{\"a\":[1,{\"b\":\"]}\"}]},[[],{}],true]"},
+      {"[\"\xc3\xa9\xe2\x82\xac\xf0\x9f\x98\x80\"]",
+       "[\"\xc3\xa9\xe2\x82\xac\xf0\x9f\x98\x80\"]"},
+      {"{\"x\": [1, 2]}", "{\"x\":[1,2]}"},
+      {"  42 ", "42"},
+  };
+  for (auto [input, expected] : kCases) {
+    for (size_t chunk_size : {1, 2, 3, 7, 1000}) {
+      Local<Value> result =
+          StreamingParseJSON(context.local(), input, chunk_size)
+              .ToLocalChecked();
+      Local<String> json =
+          v8::JSON::Stringify(context.local(), result).ToLocalChecked();
+      v8::String::Utf8Value utf8(context->GetIsolate(), json);
+      CHECK_EQ(0, strcmp(expected, *utf8));
+    }
+  }
+}
+
+THREADED_TEST(JSONStreamingParseErrors) {
+  LocalContext context;
+  HandleScope scope(context->GetIsolate());
+  const char* kCases[] = {"",     "[",    "[1",    "[1,",   "[1,]",
+                          "[,1]", "[1 2]", "[1]x", "[1] ]", "[{]}",
+                          "[1}]", "[01]", "[\"a]", "{\"a\""};
+  for (const char* input : kCases) {
+    for (size_t chunk_size : {1, 2, 1000}) {
+      v8::TryCatch try_catch(context->GetIsolate());
+      CHECK(StreamingParseJSON(context.local(), input, chunk_size).IsEmpty());
+      CHECK(try_catch.HasCaught());
+      CHECK(try_catch.Exception()->IsNativeError());
+    }
+  }
+}
+
 THREADED_TEST(JSONStringifyObject) {
   LocalContext context;
   HandleScope scope(context->GetIsolate());
@@ -4251,6 +4251,14 @@ TEST(RunWasmTurbofan_I64x4Shl) {
                            compiler::IrOpcode::kI64x4Shl);
 }
 
+TEST(RunWasmTurbofan_I64x4ShrS) {
+  // Arithmetic right shifts of 64-bit lanes are only revectorized with
+  // AVX-512.
+  if (!CpuFeatures::IsSupported(AVX512)) return;
+  RunI64x4ShiftOpRevecTest(kExprI64x2ShrS, ArithmeticShiftRight,
+                           compiler::IrOpcode::kI64x4ShrS);
+}
+
 TEST(RunWasmTurbofan_I64x4ShrU) {
   RunI64x4ShiftOpRevecTest(kExprI64x2ShrU, LogicalShiftRight,
                            compiler::IrOpcode::kI64x4ShrU);
@@ -174,6 +174,67 @@ TEST(CacheHitMissSig) {
   CHECK_EQ(c2, c4);
 }
 
+TEST(CacheConcurrentCompilation) {
+  Isolate* isolate = CcTest::InitIsolateOnce();
+  TestSignatures sigs;
+
+  auto kind = ImportCallKind::kJSFunctionArityMatch;
+  auto sig = sigs.i_iii();
+  int expected_arity = static_cast<int>(sig->parameter_count());
+  CanonicalTypeIndex type_index =
+      GetTypeCanonicalizer()->AddRecursiveGroup(sig);
+  auto* canonical_sig =
+      GetTypeCanonicalizer()->LookupFunctionSignature(type_index);
+
+  // All threads must end up with the same wrapper, no matter whether they
+  // compiled it, waited for another thread compiling it, or found it in the
+  // cache.
+  class CompileThread : public v8::base::Thread {
+   public:
+    CompileThread(Isolate* isolate, ImportCallKind kind,
+                  const CanonicalSig* sig, CanonicalTypeIndex type_index,
+                  int expected_arity)
+        : Thread(Options("CompileThread")),
+          isolate_(isolate),
+          kind_(kind),
+          sig_(sig),
+          type_index_(type_index),
+          expected_arity_(expected_arity) {}
+
+    void Run() override {
+      WasmCodeRefScope wasm_code_ref_scope;
+      result_ = GetWasmImportWrapperCache()->CompileWasmImportCallWrapper(
+          isolate_, kind_, sig_, type_index_, false, expected_arity_,
+          kNoSuspend);
+    }
+
+    WasmCode* result() const { return result_; }
+
+   private:
+    Isolate* const isolate_;
+    const ImportCallKind kind_;
+    const CanonicalSig* const sig_;
+    const CanonicalTypeIndex type_index_;
+    const int expected_arity_;
+    WasmCode* result_ = nullptr;
+  };
+
+  WasmCodeRefScope wasm_code_ref_scope;
+  constexpr int kNumThreads = 4;
+  std::vector<std::unique_ptr<CompileThread>> threads;
+  for (int i = 0; i < kNumThreads; ++i) {
+    threads.emplace_back(std::make_unique<CompileThread>(
+        isolate, kind, canonical_sig, type_index, expected_arity));
+  }
+  for (auto& thread : threads) CHECK(thread->Start());
+  for (auto& thread : threads) thread->Join();
+
+  WasmCode* cached = GetWasmImportWrapperCache()->MaybeGet(
+      kind, type_index, expected_arity, kNoSuspend);
+  CHECK_NOT_NULL(cached);
+  for (auto& thread : threads) CHECK_EQ(cached, thread->result());
+}
+
 }  // namespace test_wasm_import_wrapper_cache
 }  // namespace wasm
 }  // namespace internal
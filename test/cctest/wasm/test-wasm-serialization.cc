@@ -109,6 +109,9 @@ class WasmSerializationTest {
   }
 
   v8::MemorySpan<const uint8_t> wire_bytes() const { return wire_bytes_; }
+  v8::MemorySpan<const uint8_t> serialized_bytes() const {
+    return serialized_bytes_;
+  }
 
   CompileTimeImports MakeCompileTimeImports() { return CompileTimeImports{}; }
 
@@ -218,6 +221,56 @@ TEST(DeserializeValidModule) {
   test.CollectGarbage();
 }
 
+TEST(DeserializeTwiceSharesNativeModule) {
+  WasmSerializationTest test;
+  {
+    HandleScope scope(CcTest::i_isolate());
+    Handle<WasmModuleObject> first;
+    Handle<WasmModuleObject> second;
+    CHECK(test.Deserialize().ToHandle(&first));
+    // The second deserialization finds the module in the native module cache
+    // and does not decode the wire bytes again. Decoding would fail with this
+    // limit on the module size.
+    FlagScope<size_t> tiny_module_size(&v8_flags.wasm_max_module_size, 16);
+    CHECK_LT(max_module_size(), first->native_module()->wire_bytes().size());
+    CHECK(test.Deserialize().ToHandle(&second));
+    CHECK_EQ(first->native_module(), second->native_module());
+  }
+  test.CollectGarbage();
+}
+
+TEST(DeserializeLazilyAndRun) {
+  WasmSerializationTest test;
+  FlagScope<bool> lazy_deserialization(&v8_flags.wasm_lazy_deserialization,
+                                       true);
+  {
+    HandleScope scope(CcTest::i_isolate());
+    // The exported function is only copied and relocated on its first call.
+    test.DeserializeAndRun();
+  }
+  test.CollectGarbage();
+}
+
+TEST(DeserializeLazilyAndSerializeAgain) {
+  WasmSerializationTest test;
+  FlagScope<bool> lazy_deserialization(&v8_flags.wasm_lazy_deserialization,
+                                       true);
+  {
+    HandleScope scope(CcTest::i_isolate());
+    Handle<WasmModuleObject> module_object;
+    CHECK(test.Deserialize().ToHandle(&module_object));
+    // None of the functions was called, so the code they were deserialized
+    // from is written again unchanged.
+    WasmSerializer serializer(module_object->native_module());
+    size_t size = serializer.GetSerializedNativeModuleSize();
+    CHECK_EQ(test.serialized_bytes().size(), size);
+    std::unique_ptr<uint8_t[]> buffer(new uint8_t[size]);
+    CHECK(serializer.SerializeNativeModule({buffer.get(), size}));
+    CHECK_EQ(0, memcmp(test.serialized_bytes().data(), buffer.get(), size));
+  }
+  test.CollectGarbage();
+}
+
 TEST(DeserializeWithSourceUrl) {
   WasmSerializationTest test;
   {
@@ -13,6 +13,7 @@
 #include "src/wasm/wasm-objects-inl.h"
 
 #include "test/cctest/cctest.h"
+#include "test/common/flag-utils.h"
 #include "test/common/wasm/test-signatures.h"
 #include "test/common/wasm/wasm-macro-gen.h"
 #include "test/common/wasm/wasm-module-runner.h"
@@ -308,6 +309,41 @@ TEST(SharedEngineRunThreadedTierUp) {
   for (auto& thread : threads) thread.Join();
 }
 
+TEST(SharedEngineReuseKeptAliveModule) {
+  FlagScope<unsigned> keep_alive(
+      &v8_flags.wasm_native_module_cache_keep_alive, 1);
+  const NativeModule* native_module;
+  {
+    SharedEngineIsolate isolate;
+    HandleScope scope(isolate.isolate());
+    ZoneBuffer* buffer = BuildReturnConstantModule(isolate.zone(), 23);
+    DirectHandle<WasmInstanceObject> instance =
+        isolate.CompileAndInstantiate(buffer);
+    SharedModule module = isolate.ExportInstance(instance);
+    WasmDetectedFeatures detected;
+    WasmCompilationUnit::CompileWasmFunction(
+        isolate.isolate()->counters(), module.get(), &detected,
+        &module->module()->functions[0], ExecutionTier::kTurbofan);
+    native_module = module.get();
+  }
+  // The first isolate died, but compiling the same bytes again reuses the
+  // tiered-up code of the cached module.
+  {
+    SharedEngineIsolate isolate;
+    HandleScope scope(isolate.isolate());
+    ZoneBuffer* buffer = BuildReturnConstantModule(isolate.zone(), 23);
+    Handle<WasmInstanceObject> instance = isolate.CompileAndInstantiate(buffer);
+    SharedModule module = isolate.ExportInstance(instance);
+    CHECK_EQ(native_module, module.get());
+    {
+      WasmCodeRefScope code_ref_scope;
+      CHECK_EQ(ExecutionTier::kTurbofan, module->GetCode(0)->tier());
+    }
+    CHECK_EQ(23, isolate.Run(instance));
+  }
+  GetWasmEngine()->ReleaseCachedNativeModules();
+}
+
 }  // namespace test_wasm_shared_engine
 }  // namespace wasm
 }  // namespace internal
@@ -0,0 +1,127 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Floating point kernels with plenty of independent operations inside basic
+// blocks, to measure the effect of --turbo-instruction-scheduling.
+
+function CreateBenchmark(name, f, setup) {
+  new BenchmarkSuite(name, [1000], [
+    new Benchmark(name, false, false, 0, f, setup)
+  ]);
+}
+
+const kSize = 256;
+let xs;
+let ys;
+let result;
+
+function SetupVectors() {
+  xs = new Float64Array(kSize);
+  ys = new Float64Array(kSize);
+  for (let i = 0; i < kSize; i++) {
+    xs[i] = Math.sin(i) * 0.5;
+    ys[i] = Math.cos(i) * 0.5;
+  }
+}
+
+// Evaluate a degree 7 polynomial with Estrin's scheme, which exposes
+// independent multiply-adds.
+function Polynomial() {
+  let sum = 0;
+  for (let i = 0; i < kSize; i++) {
+    const x = xs[i];
+    const x2 = x * x;
+    const x4 = x2 * x2;
+    const p01 = 1.0 + 0.5 * x;
+    const p23 = 0.25 + 0.125 * x;
+    const p45 = 0.0625 + 0.03125 * x;
+    const p67 = 0.015625 + 0.0078125 * x;
+    sum += (p01 + p23 * x2) + (p45 + p67 * x2) * x4;
+  }
+  result = sum;
+}
+
+// Dot product with four independent accumulators.
+function DotProduct() {
+  let a0 = 0, a1 = 0, a2 = 0, a3 = 0;
+  for (let i = 0; i < kSize; i += 4) {
+    a0 += xs[i] * ys[i];
+    a1 += xs[i + 1] * ys[i + 1];
+    a2 += xs[i + 2] * ys[i + 2];
+    a3 += xs[i + 3] * ys[i + 3];
+  }
+  result = (a0 + a1) + (a2 + a3);
+}
+
+// Multiply 4x4 matrices stored in a Float64Array.
+let ma;
+let mb;
+let mc;
+
+function SetupMatrices() {
+  SetupVectors();
+  ma = new Float64Array(16);
+  mb = new Float64Array(16);
+  mc = new Float64Array(16);
+  for (let i = 0; i < 16; i++) {
+    ma[i] = xs[i];
+    mb[i] = ys[i];
+  }
+}
+
+function MatrixMultiply() {
+  for (let n = 0; n < 64; n++) {
+    for (let r = 0; r < 4; r++) {
+      const a0 = ma[r * 4], a1 = ma[r * 4 + 1];
+      const a2 = ma[r * 4 + 2], a3 = ma[r * 4 + 3];
+      for (let c = 0; c < 4; c++) {
+        mc[r * 4 + c] = a0 * mb[c] + a1 * mb[4 + c] + a2 * mb[8 + c] +
+                        a3 * mb[12 + c];
+      }
+    }
+  }
+  result = mc[0];
+}
+
+// One step of a small n-body simulation.
+const kBodies = 16;
+let px, py, vx, vy;
+
+function SetupBodies() {
+  px = new Float64Array(kBodies);
+  py = new Float64Array(kBodies);
+  vx = new Float64Array(kBodies);
+  vy = new Float64Array(kBodies);
+  for (let i = 0; i < kBodies; i++) {
+    px[i] = Math.cos(i);
+    py[i] = Math.sin(i);
+  }
+}
+
+function NBody() {
+  for (let i = 0; i < kBodies; i++) {
+    let fx = 0, fy = 0;
+    for (let j = 0; j < kBodies; j++) {
+      if (i === j) continue;
+      const dx = px[j] - px[i];
+      const dy = py[j] - py[i];
+      const d2 = dx * dx + dy * dy + 0.01;
+      const inv = 1 / (d2 * Math.sqrt(d2));
+      fx += dx * inv;
+      fy += dy * inv;
+    }
+    vx[i] += fx * 0.001;
+    vy[i] += fy * 0.001;
+  }
+  for (let i = 0; i < kBodies; i++) {
+    px[i] += vx[i] * 0.001;
+    py[i] += vy[i] * 0.001;
+  }
+  result = px[0];
+}
+
+CreateBenchmark('Polynomial', Polynomial, SetupVectors);
+CreateBenchmark('DotProduct', DotProduct, SetupVectors);
+CreateBenchmark('MatrixMultiply', MatrixMultiply, SetupMatrices);
+CreateBenchmark('NBody', NBody, SetupBodies);
@@ -0,0 +1,49 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Deterministic payloads resembling API responses, shared by the JSON
+// benchmarks.
+
+const kLoremIpsum =
+    'Lorem ipsum dolor sit amet, consectetur adipiscing elit, sed do ' +
+    'eiusmod tempor incididunt ut labore et dolore magna aliqua. Ut enim ' +
+    'ad minim veniam, quis nostrud exercitation ullamco laboris nisi ut ' +
+    'aliquip ex ea commodo consequat. ';
+const kTwoByteText =
+    'Съешь же ещё этих мягких французских булок, да выпей чаю. ' +
+    '敏捷的棕色狐狸跳过了懒狗。 ';
+
+function CreateRecords(count, text) {
+  let records = [];
+  for (let i = 0; i < count; i++) {
+    records.push({
+      id: i,
+      guid: 'a1b2c3d4-' + (100000 + i) + '-e5f6',
+      active: i % 3 != 0,
+      balance: i * 17.25,
+      name: 'User Name ' + i,
+      email: 'user' + i + '@example.com',
+      about: text.repeat(1 + i % 4),
+      tags: ['alpha', 'beta', 'gamma', 'tag' + (i % 10)],
+      address: {
+        street: i + ' Main Street',
+        city: 'Springfield',
+        zip: String(10000 + i),
+      },
+    });
+  }
+  return records;
+}
+
+function CreateLongStrings(count, length) {
+  let strings = [];
+  for (let i = 0; i < count; i++) {
+    // Mostly plain text with an occasional character that needs escaping.
+    let s = kLoremIpsum.repeat(Math.ceil(length / kLoremIpsum.length))
+        .substring(0, length);
+    strings.push(s.substring(0, length >> 1) + '"quoted"\n' +
+                 s.substring(length >> 1));
+  }
+  return strings;
+}
@@ -0,0 +1,17 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+d8.file.execute('data.js');
+
+function CreateParseBenchmark(name, value, space) {
+  const json = JSON.stringify(value, null, space);
+  new BenchmarkSuite(name, [1000], [
+    new Benchmark(name, false, false, 0, () => JSON.parse(json)),
+  ]);
+}
+
+CreateParseBenchmark('ParseRecords', CreateRecords(1000, kLoremIpsum));
+CreateParseBenchmark('ParsePrettyRecords', CreateRecords(1000, kLoremIpsum), 2);
+CreateParseBenchmark('ParseTwoByteRecords', CreateRecords(1000, kTwoByteText));
+CreateParseBenchmark('ParseLongStrings', CreateLongStrings(100, 10000));
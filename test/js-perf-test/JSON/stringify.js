@@ -0,0 +1,19 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+d8.file.execute('data.js');
+
+function CreateStringifyBenchmark(name, value, space) {
+  new BenchmarkSuite(name, [1000], [
+    new Benchmark(name, false, false, 0,
+                  () => JSON.stringify(value, null, space)),
+  ]);
+}
+
+CreateStringifyBenchmark('StringifyRecords', CreateRecords(1000, kLoremIpsum));
+CreateStringifyBenchmark('StringifyPrettyRecords',
+                         CreateRecords(1000, kLoremIpsum), 2);
+CreateStringifyBenchmark('StringifyTwoByteRecords',
+                         CreateRecords(1000, kTwoByteText));
+CreateStringifyBenchmark('StringifyLongStrings', CreateLongStrings(100, 10000));
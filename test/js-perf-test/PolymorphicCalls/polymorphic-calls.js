@@ -0,0 +1,61 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+function CreateBenchmark(name, f) {
+  new BenchmarkSuite(name, [1000], [
+    new Benchmark(name, false, false, 0, f, Setup, TearDown)
+  ]);
+}
+
+const kIterations = 1000;
+let result;
+
+// Visitor pattern with {n} node classes sharing one call site.
+class Lit { visit(acc) { return acc + 1; } }
+class Add { visit(acc) { return acc + 2; } }
+class Mul { visit(acc) { return acc * 1; } }
+class Neg { visit(acc) { return acc - 1; } }
+
+const kAllNodes = [new Lit(), new Add(), new Mul(), new Neg()];
+let nodes;
+
+function MakeNodes(n) {
+  let list = [];
+  for (let i = 0; i < 100; i++) list.push(kAllNodes[i % n]);
+  return list;
+}
+
+function Visit() {
+  let acc = 0;
+  for (let i = 0; i < kIterations; i++) {
+    for (let j = 0; j < nodes.length; j++) acc = nodes[j].visit(acc);
+  }
+  result = acc;
+}
+
+// Callback selected by a condition at the call site.
+function inc(x) { return x + 1; }
+function dec(x) { return x - 1; }
+
+function Select() {
+  let acc = 0;
+  for (let i = 0; i < kIterations * 100; i++) {
+    let f = (i & 1) ? inc : dec;
+    acc = f(acc);
+  }
+  result = acc;
+}
+
+function Setup() {
+  result = undefined;
+}
+
+function TearDown() {
+  return result !== undefined;
+}
+
+CreateBenchmark('Visit1', () => { nodes = MakeNodes(1); Visit(); });
+CreateBenchmark('Visit2', () => { nodes = MakeNodes(2); Visit(); });
+CreateBenchmark('Visit4', () => { nodes = MakeNodes(4); Visit(); });
+CreateBenchmark('Select', Select);
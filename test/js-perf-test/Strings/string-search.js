@@ -0,0 +1,63 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Searches for patterns of different lengths in long one-byte and two-byte
+// subjects, where the pattern is found only near the end.
+
+function CreateSearchBenchmark(name, subject, patterns, search) {
+  new BenchmarkSuite(name, [100], [
+    new Benchmark(name, false, false, 0, () => {
+      let result = 0;
+      for (const pattern of patterns) result += search(subject, pattern);
+      if (result < 0) throw new Error(`${name}: pattern not found`);
+    }),
+  ]);
+}
+
+function MakeText(words, length) {
+  let text = '';
+  for (let i = 0; text.length < length; i++) {
+    text += words[(i * 7) % words.length] + ' ';
+  }
+  return text;
+}
+
+const kOneByteText = MakeText(
+    ['lorem', 'ipsum', 'dolor', 'sit', 'amet', 'consectetur', 'adipiscing',
+     'elit', 'sed', 'do', 'eiusmod', 'tempor'], 100000);
+const kTwoByteText = MakeText(
+    ['лорем', 'ипсум', 'долор', 'сит', 'амет', 'консектетур', 'elit',
+     'sed', 'do', 'эиусмод'], 100000);
+
+// The needles are appended to the subject so that every search succeeds.
+const kShortPatterns = ['Z', 'Zq', 'Zqx', 'Zqxj'];
+const kLongPatterns = ['Zqxjkvw', 'Zqxjkvwpbfhmg', 'Zqxjkvwpbfhmgzuyrtlsnoc'];
+const kOneByteSubject =
+    kOneByteText + [...kShortPatterns, ...kLongPatterns].join(' ');
+const kTwoByteSubject =
+    kTwoByteText + [...kShortPatterns, ...kLongPatterns].join(' ');
+
+const indexOf = (subject, pattern) => subject.indexOf(pattern);
+const includes = (subject, pattern) => subject.includes(pattern) ? 1 : -1;
+const split = (subject, pattern) => subject.split(pattern).length - 2;
+const replaceAll = (subject, pattern) =>
+    subject.replaceAll(pattern, '#').length;
+
+CreateSearchBenchmark('IndexOfShort', kOneByteSubject, kShortPatterns,
+                      indexOf);
+CreateSearchBenchmark('IndexOfLong', kOneByteSubject, kLongPatterns, indexOf);
+CreateSearchBenchmark('IndexOfShortTwoByte', kTwoByteSubject, kShortPatterns,
+                      indexOf);
+CreateSearchBenchmark('IndexOfLongTwoByte', kTwoByteSubject, kLongPatterns,
+                      indexOf);
+CreateSearchBenchmark('Includes', kOneByteSubject, kShortPatterns, includes);
+CreateSearchBenchmark('IncludesTwoByte', kTwoByteSubject, kShortPatterns,
+                      includes);
+CreateSearchBenchmark('SplitRare', kOneByteSubject, kShortPatterns, split);
+CreateSearchBenchmark('SplitRareTwoByte', kTwoByteSubject, kShortPatterns,
+                      split);
+CreateSearchBenchmark('ReplaceAllRare', kOneByteSubject, kLongPatterns,
+                      replaceAll);
+CreateSearchBenchmark('ReplaceAllRareTwoByte', kTwoByteSubject, kLongPatterns,
+                      replaceAll);
@@ -0,0 +1,193 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+/**
+ * Note: The wasm module builder is not available for performance tests.
+ * To change the wasm code, switch the use_module_builder flag to true, update
+ * the code and run it using d8. It will print the bytes that then have to be
+ * updated for the !use_module_builder path.
+ */
+let use_module_builder = false;
+if (use_module_builder) {
+  d8.file.execute('../../mjsunit/wasm/wasm-module-builder.js');
+}
+
+/**
+ * Test performance of the bulk operations on wasm arrays.
+ * The different suites measure the following:
+ * CopyI8Short:  array.copy of 100 elements of an i8 array (inlined copy).
+ * CopyI32Short: array.copy of 32 elements of an i32 array (inlined copy).
+ * CopyI32Long:  array.copy of 4000 elements of an i32 array.
+ * CopyRefLong:  array.copy of 4000 elements of an anyref array.
+ * FillI32Long:  array.fill of 4000 elements of an i32 array.
+ * InitDataI8:   array.init_data of 256 elements of an i8 array.
+ */
+(function() {
+  // Compile and instantiate wasm.
+  let instance;
+
+  if (use_module_builder) {
+    let builder = new WasmModuleBuilder();
+    let bytes = builder.addArray(kWasmI8, true);
+    let words = builder.addArray(kWasmI32, true);
+    let struct = builder.addStruct([]);
+    let refs = builder.addArray(kWasmAnyRef, true);
+    let segment_bytes = [];
+    for (let i = 0; i < 256; i++) segment_bytes.push(i);
+    let segment = builder.addPassiveDataSegment(segment_bytes);
+    const kArrayLength = 4096;
+
+    // Creates two arrays and copies {length} elements from the first one into
+    // the second one {iterations} times.
+    function addCopy(name, array, new_array, get_first) {
+      builder.addFunction(name,
+          makeSig([kWasmI32 /*iterations*/, kWasmI32 /*length*/], [kWasmI32]))
+        .addLocals(wasmRefNullType(array), 2)  // from, to
+        .addBody([
+          ...new_array, kExprLocalSet, 2,
+          ...new_array, kExprLocalSet, 3,
+          kExprLoop, kWasmVoid,
+            kExprLocalGet, 3, kExprI32Const, 1,
+            kExprLocalGet, 2, kExprI32Const, 0,
+            kExprLocalGet, 1,
+            kGCPrefix, kExprArrayCopy, array, array,
+            // if (--iterations != 0) continue;
+            kExprLocalGet, 0, kExprI32Const, 1, kExprI32Sub,
+            kExprLocalTee, 0,
+            kExprBrIf, 0,
+          kExprEnd,
+          kExprLocalGet, 3, kExprI32Const, 1,
+          ...get_first,
+        ])
+        .exportFunc();
+    }
+
+    addCopy('copyBytes', bytes,
+            [...wasmI32Const(kArrayLength),
+             kGCPrefix, kExprArrayNewDefault, bytes],
+            [kGCPrefix, kExprArrayGetU, bytes]);
+    addCopy('copyWords', words,
+            [...wasmI32Const(kArrayLength),
+             kGCPrefix, kExprArrayNewDefault, words],
+            [kGCPrefix, kExprArrayGet, words]);
+    addCopy('copyRefs', refs,
+            [kGCPrefix, kExprStructNewDefault, struct,
+             ...wasmI32Const(kArrayLength), kGCPrefix, kExprArrayNew, refs],
+            [kGCPrefix, kExprArrayGet, refs, kExprRefIsNull]);
+
+    builder.addFunction('fillWords',
+        makeSig([kWasmI32 /*iterations*/, kWasmI32 /*length*/], [kWasmI32]))
+      .addLocals(wasmRefNullType(words), 1)
+      .addBody([
+        ...wasmI32Const(kArrayLength), kGCPrefix, kExprArrayNewDefault, words,
+        kExprLocalSet, 2,
+        kExprLoop, kWasmVoid,
+          kExprLocalGet, 2, kExprI32Const, 0, kExprLocalGet, 0,
+          kExprLocalGet, 1,
+          kGCPrefix, kExprArrayFill, words,
+          // if (--iterations != 0) continue;
+          kExprLocalGet, 0, kExprI32Const, 1, kExprI32Sub,
+          kExprLocalTee, 0,
+          kExprBrIf, 0,
+        kExprEnd,
+        kExprLocalGet, 2, kExprI32Const, 0,
+        kGCPrefix, kExprArrayGet, words,
+      ])
+      .exportFunc();
+
+    builder.addFunction('initBytes',
+        makeSig([kWasmI32 /*iterations*/, kWasmI32 /*length*/], [kWasmI32]))
+      .addLocals(wasmRefNullType(bytes), 1)
+      .addBody([
+        ...wasmI32Const(kArrayLength), kGCPrefix, kExprArrayNewDefault, bytes,
+        kExprLocalSet, 2,
+        kExprLoop, kWasmVoid,
+          kExprLocalGet, 2, kExprI32Const, 0, kExprI32Const, 0,
+          kExprLocalGet, 1,
+          kGCPrefix, kExprArrayInitData, bytes, segment,
+          // if (--iterations != 0) continue;
+          kExprLocalGet, 0, kExprI32Const, 1, kExprI32Sub,
+          kExprLocalTee, 0,
+          kExprBrIf, 0,
+        kExprEnd,
+        kExprLocalGet, 2, kExprI32Const, 255,
+        kGCPrefix, kExprArrayGetU, bytes,
+      ])
+      .exportFunc();
+
+    print(builder.toBuffer());
+    instance = builder.instantiate({});
+  } else {
+    instance = new WebAssembly.Instance(new WebAssembly.Module(new Uint8Array([
+      0, 97, 115, 109, 1, 0, 0, 0, 1, 50, 9, 80, 0, 94, 120, 1, 80, 0, 94, 127,
+      1, 80, 0, 95, 0, 80, 0, 94, 110, 1, 96, 2, 127, 127, 1, 127, 96, 2, 127,
+      127, 1, 127, 96, 2, 127, 127, 1, 127, 96, 2, 127, 127, 1, 127, 96, 2, 127,
+      127, 1, 127, 3, 6, 5, 4, 5, 6, 7, 8, 7, 60, 5, 9, 99, 111, 112, 121, 66,
+      121, 116, 101, 115, 0, 0, 9, 99, 111, 112, 121, 87, 111, 114, 100, 115, 0,
+      1, 8, 99, 111, 112, 121, 82, 101, 102, 115, 0, 2, 9, 102, 105, 108, 108,
+      87, 111, 114, 100, 115, 0, 3, 9, 105, 110, 105, 116, 66, 121, 116, 101,
+      115, 0, 4, 12, 1, 1, 10, 134, 2, 5, 54, 1, 2, 99, 0, 65, 128, 32, 251, 7,
+      0, 33, 2, 65, 128, 32, 251, 7, 0, 33, 3, 3, 64, 32, 3, 65, 1, 32, 2, 65,
+      0, 32, 1, 251, 17, 0, 0, 32, 0, 65, 1, 107, 34, 0, 13, 0, 11, 32, 3, 65,
+      1, 251, 13, 0, 11, 54, 1, 2, 99, 1, 65, 128, 32, 251, 7, 1, 33, 2, 65,
+      128, 32, 251, 7, 1, 33, 3, 3, 64, 32, 3, 65, 1, 32, 2, 65, 0, 32, 1, 251,
+      17, 1, 1, 32, 0, 65, 1, 107, 34, 0, 13, 0, 11, 32, 3, 65, 1, 251, 11, 1,
+      11, 61, 1, 2, 99, 3, 251, 1, 2, 65, 128, 32, 251, 6, 3, 33, 2, 251, 1, 2,
+      65, 128, 32, 251, 6, 3, 33, 3, 3, 64, 32, 3, 65, 1, 32, 2, 65, 0, 32, 1,
+      251, 17, 3, 3, 32, 0, 65, 1, 107, 34, 0, 13, 0, 11, 32, 3, 65, 1, 251, 11,
+      3, 209, 11, 43, 1, 1, 99, 1, 65, 128, 32, 251, 7, 1, 33, 2, 3, 64, 32, 2,
+      65, 0, 32, 0, 32, 1, 251, 16, 1, 32, 0, 65, 1, 107, 34, 0, 13, 0, 11, 32,
+      2, 65, 0, 251, 11, 1, 11, 44, 1, 1, 99, 0, 65, 128, 32, 251, 7, 0, 33, 2,
+      3, 64, 32, 2, 65, 0, 65, 0, 32, 1, 251, 18, 0, 0, 32, 0, 65, 1, 107, 34,
+      0, 13, 0, 11, 32, 2, 65, 255, 251, 13, 0, 11, 11, 132, 2, 1, 1, 128, 2, 0,
+      1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21,
+      22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39,
+      40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57,
+      58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75,
+      76, 77, 78, 79, 80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93,
+      94, 95, 96, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109,
+      110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124,
+      125, 126, 127, 128, 129, 130, 131, 132, 133, 134, 135, 136, 137, 138, 139,
+      140, 141, 142, 143, 144, 145, 146, 147, 148, 149, 150, 151, 152, 153, 154,
+      155, 156, 157, 158, 159, 160, 161, 162, 163, 164, 165, 166, 167, 168, 169,
+      170, 171, 172, 173, 174, 175, 176, 177, 178, 179, 180, 181, 182, 183, 184,
+      185, 186, 187, 188, 189, 190, 191, 192, 193, 194, 195, 196, 197, 198, 199,
+      200, 201, 202, 203, 204, 205, 206, 207, 208, 209, 210, 211, 212, 213, 214,
+      215, 216, 217, 218, 219, 220, 221, 222, 223, 224, 225, 226, 227, 228, 229,
+      230, 231, 232, 233, 234, 235, 236, 237, 238, 239, 240, 241, 242, 243, 244,
+      245, 246, 247, 248, 249, 250, 251, 252, 253, 254, 255, 0, 62, 4, 110, 97,
+      109, 101, 1, 55, 5, 0, 9, 99, 111, 112, 121, 66, 121, 116, 101, 115, 1, 9,
+      99, 111, 112, 121, 87, 111, 114, 100, 115, 2, 8, 99, 111, 112, 121, 82,
+      101, 102, 115, 3, 9, 102, 105, 108, 108, 87, 111, 114, 100, 115, 4, 9,
+      105, 110, 105, 116, 66, 121, 116, 101, 115
+    ])), {});
+  }
+
+  let wasm = instance.exports;
+
+  let benchmarks = [
+    function CopyI8Short() {
+      assertEquals(0, wasm.copyBytes(1000, 100));
+    },
+    function CopyI32Short() {
+      assertEquals(0, wasm.copyWords(1000, 32));
+    },
+    function CopyI32Long() {
+      assertEquals(0, wasm.copyWords(100, 4000));
+    },
+    function CopyRefLong() {
+      assertEquals(0, wasm.copyRefs(100, 4000));
+    },
+    function FillI32Long() {
+      assertEquals(1, wasm.fillWords(100, 4000));
+    },
+    function InitDataI8() {
+      assertEquals(255, wasm.initBytes(1000, 256));
+    }
+  ];
+
+  for (let fct of benchmarks) {
+    createSuite(fct.name, 100, fct);
+  }
+})();
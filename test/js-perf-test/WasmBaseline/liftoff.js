@@ -0,0 +1,132 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Measures code produced by Liftoff (run with --liftoff-only): integer
+// arithmetic with constant operands and multi-value merges.
+// The wasm module builder is not available for performance tests, so the
+// module is assembled by hand below.
+//
+// Execution: Runs the kernel function.
+// Compile:   Compiles a module with many copies of the kernel function.
+
+function CreateBenchmark(name, f, setup) {
+  new BenchmarkSuite(name, [1000], [
+    new Benchmark(name, false, false, 0, f, setup)
+  ]);
+}
+
+const kLoop = 0x03;
+const kIf = 0x04;
+const kElse = 0x05;
+const kEnd = 0x0b;
+const kBrIf = 0x0d;
+const kLocalGet = 0x20;
+const kLocalSet = 0x21;
+const kLocalTee = 0x22;
+const kI32Const = 0x41;
+const kI32LtU = 0x49;
+const kI32Add = 0x6a;
+const kI32Sub = 0x6b;
+const kI32Mul = 0x6c;
+const kI32And = 0x71;
+const kI32Xor = 0x73;
+const kI32Shl = 0x74;
+const kI32 = 0x7f;
+const kVoidBlock = 0x40;
+
+function Leb(value) {
+  const bytes = [];
+  do {
+    let b = value & 0x7f;
+    value >>>= 7;
+    if (value) b |= 0x80;
+    bytes.push(b);
+  } while (value);
+  return bytes;
+}
+
+function Section(id, contents) {
+  return [id, ...Leb(contents.length), ...contents];
+}
+
+// (func (param $n i32) (result i32) (local $i i32) (local $acc i32) ...)
+// All constants are small enough to be encoded as single byte LEBs.
+const kKernelBody = [
+  1, 2, kI32,  // locals
+  kLoop, kVoidBlock,
+    // acc = (acc + ((i * 3 + 7) & 63)) ^ (1 << 4)
+    kLocalGet, 2,
+    kLocalGet, 1, kI32Const, 3, kI32Mul, kI32Const, 7, kI32Add,
+    kI32Const, 0x3f, kI32And,
+    kI32Add,
+    kI32Const, 1, kI32Const, 4, kI32Shl,
+    kI32Xor,
+    kLocalSet, 2,
+    // acc = i & 1 ? (acc + 5) ^ (i & 7) : (acc - 3) ^ (2 << 3)
+    kLocalGet, 1, kI32Const, 1, kI32And,
+    kIf, 1,  // [] -> [i32 i32]
+      kLocalGet, 2, kI32Const, 5, kI32Add,
+      kLocalGet, 1, kI32Const, 7, kI32And,
+    kElse,
+      kLocalGet, 2, kI32Const, 3, kI32Sub,
+      kI32Const, 2, kI32Const, 3, kI32Shl,
+    kEnd,
+    kI32Xor,
+    kLocalSet, 2,
+    // while (++i < n)
+    kLocalGet, 1, kI32Const, 1, kI32Add, kLocalTee, 1,
+    kLocalGet, 0, kI32LtU,
+    kBrIf, 0,
+  kEnd,
+  kLocalGet, 2,
+  kEnd
+];
+
+function BuildModule(num_functions) {
+  const types = [
+    2,                                // count
+    0x60, 1, kI32, 1, kI32,           // [i32] -> [i32]
+    0x60, 0, 2, kI32, kI32            // [] -> [i32 i32]
+  ];
+  const functions = [...Leb(num_functions)];
+  const bodies = [...Leb(num_functions)];
+  for (let i = 0; i < num_functions; i++) {
+    functions.push(0);
+    bodies.push(...Leb(kKernelBody.length), ...kKernelBody);
+  }
+  const exports = [1, 6, ...Array.from('kernel', c => c.charCodeAt(0)), 0, 0];
+  return new Uint8Array([
+    0x00, 0x61, 0x73, 0x6d, 0x01, 0x00, 0x00, 0x00,
+    ...Section(1, types),
+    ...Section(3, functions),
+    ...Section(7, exports),
+    ...Section(10, bodies)
+  ]);
+}
+
+const kNumCompiledFunctions = 200;
+const kIterations = 10000;
+let kernel;
+let module_bytes;
+let result;
+
+function SetupExecution() {
+  const module = new WebAssembly.Module(BuildModule(1));
+  kernel = new WebAssembly.Instance(module).exports.kernel;
+}
+
+function Execution() {
+  result = kernel(kIterations);
+}
+
+function SetupCompile() {
+  module_bytes = BuildModule(kNumCompiledFunctions);
+}
+
+function Compile() {
+  result = new WebAssembly.Module(module_bytes);
+}
+
+CreateBenchmark('Execution', Execution, SetupExecution);
+CreateBenchmark('Compile', Compile, SetupCompile);
@@ -0,0 +1,150 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Measures instruction dispatch in the Wasm interpreter (run with
+// --wasm-jitless). The kernels are dominated by instruction sequences that
+// the interpreter can merge into a single handler, so comparing runs with and
+// without --drumbrake-super-instructions shows the effect of merging.
+// The wasm module builder is not available for performance tests, so the
+// modules are assembled by hand below.
+//
+// Arithmetic: Binary operators whose result is stored into a local.
+// Memory:     Loads into locals and loads followed by stores.
+
+function CreateBenchmark(name, f, setup) {
+  new BenchmarkSuite(name, [1000], [
+    new Benchmark(name, false, false, 0, f, setup)
+  ]);
+}
+
+const kLoop = 0x03;
+const kEnd = 0x0b;
+const kBrIf = 0x0d;
+const kLocalGet = 0x20;
+const kLocalSet = 0x21;
+const kI32Load = 0x28;
+const kI32Store = 0x36;
+const kI32Const = 0x41;
+const kI32LtU = 0x49;
+const kI32Add = 0x6a;
+const kI32Mul = 0x6c;
+const kI32And = 0x71;
+const kI32Xor = 0x73;
+const kI32Shl = 0x74;
+const kI32ShrU = 0x76;
+const kI32 = 0x7f;
+const kVoidBlock = 0x40;
+
+function Leb(value) {
+  const bytes = [];
+  do {
+    let b = value & 0x7f;
+    value >>>= 7;
+    if (value) b |= 0x80;
+    bytes.push(b);
+  } while (value);
+  return bytes;
+}
+
+function Section(id, contents) {
+  return [id, ...Leb(contents.length), ...contents];
+}
+
+// (func (param $n i32) (result i32) (local $i i32) (local $acc i32) ...)
+const kArithmeticBody = [
+  1, 2, kI32,  // locals
+  kLoop, kVoidBlock,
+    // acc = acc + i * 3
+    kLocalGet, 2,
+    kLocalGet, 1, kI32Const, 3, kI32Mul,
+    kI32Add,
+    kLocalSet, 2,
+    // acc = acc ^ (acc >>> 3)
+    kLocalGet, 2,
+    kLocalGet, 2, kI32Const, 3, kI32ShrU,
+    kI32Xor,
+    kLocalSet, 2,
+    // acc = acc & 0xffff
+    kLocalGet, 2, kI32Const, ...Leb(0xffff), kI32And,
+    kLocalSet, 2,
+    // while (++i < n)
+    kLocalGet, 1, kI32Const, 1, kI32Add,
+    kLocalSet, 1,
+    kLocalGet, 1, kLocalGet, 0, kI32LtU,
+    kBrIf, 0,
+  kEnd,
+  kLocalGet, 2,
+  kEnd
+];
+
+// (func (param $n i32) (result i32)
+//   (local $i i32) (local $acc i32) (local $v i32) ...)
+// Sums the words [0, n) of memory and copies them to [1024, 1024 + n).
+const kMemoryBody = [
+  1, 3, kI32,  // locals
+  kLoop, kVoidBlock,
+    // v = mem[i]
+    kLocalGet, 1, kI32Const, 2, kI32Shl,
+    kI32Load, 2, 0,
+    kLocalSet, 3,
+    // acc = acc + v + i
+    kLocalGet, 2, kLocalGet, 3, kI32Add,
+    kLocalGet, 1, kI32Add,
+    kLocalSet, 2,
+    // mem[1024 + i] = mem[i]
+    kLocalGet, 1, kI32Const, 2, kI32Shl,
+    kLocalGet, 1, kI32Const, 2, kI32Shl,
+    kI32Load, 2, 0,
+    kI32Store, 2, ...Leb(4096),
+    // while (++i < n)
+    kLocalGet, 1, kI32Const, 1, kI32Add,
+    kLocalSet, 1,
+    kLocalGet, 1, kLocalGet, 0, kI32LtU,
+    kBrIf, 0,
+  kEnd,
+  kLocalGet, 2,
+  kEnd
+];
+
+function BuildModule(body, with_memory) {
+  const types = [1, 0x60, 1, kI32, 1, kI32];  // [i32] -> [i32]
+  const functions = [1, 0];
+  const exports = [1, 6, ...Array.from('kernel', c => c.charCodeAt(0)), 0, 0];
+  const bodies = [1, ...Leb(body.length), ...body];
+  return new Uint8Array([
+    0x00, 0x61, 0x73, 0x6d, 0x01, 0x00, 0x00, 0x00,
+    ...Section(1, types),
+    ...Section(3, functions),
+    ...(with_memory ? Section(5, [1, 0, 1]) : []),
+    ...Section(7, exports),
+    ...Section(10, bodies)
+  ]);
+}
+
+// Stays within the first page of memory for the Memory kernel.
+const kIterations = 1000;
+let arithmetic_kernel;
+let memory_kernel;
+let result;
+
+function SetupArithmetic() {
+  const module = new WebAssembly.Module(BuildModule(kArithmeticBody, false));
+  arithmetic_kernel = new WebAssembly.Instance(module).exports.kernel;
+}
+
+function Arithmetic() {
+  result = arithmetic_kernel(kIterations);
+}
+
+function SetupMemory() {
+  const module = new WebAssembly.Module(BuildModule(kMemoryBody, true));
+  memory_kernel = new WebAssembly.Instance(module).exports.kernel;
+}
+
+function Memory() {
+  result = memory_kernel(kIterations);
+}
+
+CreateBenchmark('Arithmetic', Arithmetic, SetupArithmetic);
+CreateBenchmark('Memory', Memory, SetupMemory);
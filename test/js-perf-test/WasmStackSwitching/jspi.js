@@ -0,0 +1,68 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Measures the cost of JSPI stacks. Every call of the promising export runs on
+// a secondary stack that stays suspended until the promise returned by the
+// imported function resolves.
+//
+// Concurrent: Suspends 100k computations at the same time before resuming
+//             them, which stresses stack allocation and memory usage.
+// Sequential: Suspends and resumes one computation at a time, which reuses
+//             stacks from the stack pool.
+
+function CreateBenchmark(name, f) {
+  new BenchmarkSuite(name, [1000], [
+    new Benchmark(name, false, false, 0, f, Setup)
+  ]);
+}
+
+// (import "m" "wait" (func $wait (result i32)))
+// (func (export "run") (result i32) (i32.add (call $wait) (i32.const 1)))
+const kModuleBytes = new Uint8Array([
+  0, 97, 115, 109, 1, 0, 0, 0, 1, 9, 2, 96, 0, 1, 127, 96, 0, 1, 127, 2, 10,
+  1, 1, 109, 4, 119, 97, 105, 116, 0, 0, 3, 2, 1, 1, 7, 7, 1, 3, 114, 117,
+  110, 0, 1, 10, 9, 1, 7, 0, 16, 0, 65, 1, 106, 11
+]);
+
+const kConcurrentStacks = 100000;
+const kSequentialStacks = 1000;
+let run;
+let resolvers = [];
+let sum;
+
+function Setup() {
+  const wait = new WebAssembly.Suspending(
+      () => new Promise(resolve => resolvers.push(resolve)));
+  const instance = new WebAssembly.Instance(
+      new WebAssembly.Module(kModuleBytes), {m: {wait}});
+  run = WebAssembly.promising(instance.exports.run);
+  sum = 0;
+}
+
+function Add(value) {
+  sum += value;
+}
+
+function ResumeAll() {
+  for (const resolve of resolvers) resolve(1);
+  resolvers = [];
+  %PerformMicrotaskCheckpoint();
+}
+
+function Concurrent() {
+  for (let i = 0; i < kConcurrentStacks; i++) run().then(Add);
+  ResumeAll();
+  if (sum % (2 * kConcurrentStacks) != 0) throw new Error('Wrong result');
+}
+
+function Sequential() {
+  for (let i = 0; i < kSequentialStacks; i++) {
+    run().then(Add);
+    ResumeAll();
+  }
+  if (sum % (2 * kSequentialStacks) != 0) throw new Error('Wrong result');
+}
+
+CreateBenchmark('Concurrent', Concurrent);
+CreateBenchmark('Sequential', Sequential);
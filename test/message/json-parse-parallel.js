@@ -0,0 +1,16 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --json-parse-parallel --json-parse-parallel-min-length=0
+// Flags: --trace-json-parse-parallel
+
+print(JSON.stringify(JSON.parse('[1, {"a": [true, null]}, "x"]')));
+// Invalid elements fall back to the sequential parser.
+try {
+  JSON.parse('[1, 2, ]');
+} catch (e) {
+  print(e.name);
+}
+// Other values are always parsed sequentially.
+print(JSON.stringify(JSON.parse('{"a": [1, 2]}')));
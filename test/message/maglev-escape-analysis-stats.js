@@ -0,0 +1,31 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --maglev --no-turbofan
+// Flags: --maglev-escape-analysis --maglev-object-tracking
+// Flags: --maglev-escape-analysis-stats --no-always-sparkplug
+
+function sum(a, b) {
+  // Neither literal escapes, so both are elided.
+  let p = {x: a, y: b};
+  let q = {x: p.x * 2, y: p.y * 2};
+  return q.x + q.y;
+}
+
+function make(a) {
+  // The literal is returned, so it escapes.
+  return {x: a};
+}
+
+%PrepareFunctionForOptimization(sum);
+sum(1, 2);
+sum(2, 3);
+%OptimizeMaglevOnNextCall(sum);
+print(sum(3, 4));
+
+%PrepareFunctionForOptimization(make);
+make(1);
+make(2);
+%OptimizeMaglevOnNextCall(make);
+print(make(3).x);
@@ -0,0 +1,44 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --maglev --no-turbofan
+// Flags: --maglev-polymorphic-inlining --trace-maglev-polymorphic-inlining
+// Flags: --no-always-sparkplug
+
+function add(a, b) { return a + b; }
+function sub(a, b) { return a - b; }
+function mul(a, b) { return a * b; }
+
+function apply(op, a, b) {
+  let f = op == 0 ? add : (op == 1 ? sub : mul);
+  return f(a, b);
+}
+
+%PrepareFunctionForOptimization(add);
+%PrepareFunctionForOptimization(sub);
+%PrepareFunctionForOptimization(mul);
+%PrepareFunctionForOptimization(apply);
+apply(0, 2, 3);
+apply(1, 2, 3);
+apply(2, 2, 3);
+%OptimizeMaglevOnNextCall(apply);
+print(apply(0, 2, 3) + apply(1, 2, 3) + apply(2, 2, 3));
+
+class A { visit(x) { return x + 1; } }
+class B { visit(x) { return x + 2; } }
+
+function visitAll(nodes) {
+  let sum = 0;
+  for (let i = 0; i < nodes.length; i++) sum += nodes[i].visit(1);
+  return sum;
+}
+
+let nodes = [new A(), new B(), new A(), new B()];
+%PrepareFunctionForOptimization(A.prototype.visit);
+%PrepareFunctionForOptimization(B.prototype.visit);
+%PrepareFunctionForOptimization(visitAll);
+visitAll(nodes);
+visitAll(nodes);
+%OptimizeMaglevOnNextCall(visitAll);
+print(visitAll(nodes));
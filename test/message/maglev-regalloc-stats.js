@@ -0,0 +1,72 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --maglev --no-turbofan --no-always-sparkplug
+// Flags: --maglev-regalloc-stats --maglev-loop-aware-regalloc
+// Flags: --maglev-loop-aware-regalloc-max-size=60
+
+// Small enough for the loop-aware allocation mode.
+function small(n) {
+  let s = 0;
+  for (let i = 0; i < n; i++) s += i;
+  return s;
+}
+
+// Too large for the loop-aware mode, and without loops to split at.
+function large(a) {
+  let x = a;
+  x = (x * 3 + a) & 0xffff;
+  x = (x * 3 + a) & 0xffff;
+  x = (x * 3 + a) & 0xffff;
+  x = (x * 3 + a) & 0xffff;
+  x = (x * 3 + a) & 0xffff;
+  x = (x * 3 + a) & 0xffff;
+  x = (x * 3 + a) & 0xffff;
+  x = (x * 3 + a) & 0xffff;
+  x = (x * 3 + a) & 0xffff;
+  x = (x * 3 + a) & 0xffff;
+  x = (x * 3 + a) & 0xffff;
+  x = (x * 3 + a) & 0xffff;
+  x = (x * 3 + a) & 0xffff;
+  x = (x * 3 + a) & 0xffff;
+  x = (x * 3 + a) & 0xffff;
+  x = (x * 3 + a) & 0xffff;
+  x = (x * 3 + a) & 0xffff;
+  x = (x * 3 + a) & 0xffff;
+  x = (x * 3 + a) & 0xffff;
+  x = (x * 3 + a) & 0xffff;
+  x = (x * 3 + a) & 0xffff;
+  x = (x * 3 + a) & 0xffff;
+  x = (x * 3 + a) & 0xffff;
+  x = (x * 3 + a) & 0xffff;
+  x = (x * 3 + a) & 0xffff;
+  x = (x * 3 + a) & 0xffff;
+  x = (x * 3 + a) & 0xffff;
+  x = (x * 3 + a) & 0xffff;
+  x = (x * 3 + a) & 0xffff;
+  x = (x * 3 + a) & 0xffff;
+  x = (x * 3 + a) & 0xffff;
+  x = (x * 3 + a) & 0xffff;
+  x = (x * 3 + a) & 0xffff;
+  x = (x * 3 + a) & 0xffff;
+  x = (x * 3 + a) & 0xffff;
+  x = (x * 3 + a) & 0xffff;
+  x = (x * 3 + a) & 0xffff;
+  x = (x * 3 + a) & 0xffff;
+  x = (x * 3 + a) & 0xffff;
+  x = (x * 3 + a) & 0xffff;
+  return x;
+}
+
+%PrepareFunctionForOptimization(small);
+small(10);
+small(10);
+%OptimizeMaglevOnNextCall(small);
+print(small(10));
+
+%PrepareFunctionForOptimization(large);
+large(1);
+large(1);
+%OptimizeMaglevOnNextCall(large);
+print(large(1) === large(1));
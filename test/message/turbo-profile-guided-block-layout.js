@@ -0,0 +1,33 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --turbofan --no-always-turbofan --no-maglev
+// Flags: --turbo-profile-guided-block-layout
+// Flags: --trace-turbo-profile-guided-block-layout
+// Re-optimize synchronously, and keep the loop below in the interpreter, so
+// that it takes interrupt ticks.
+// Flags: --no-concurrent-recompilation --no-use-osr --no-sparkplug
+
+function handle(request) {
+  if (request.kind === 'error') {
+    return 'error: ' + request.message;
+  }
+  return request.items.length;
+}
+
+const kGood = {kind: 'ok', items: [1, 2, 3]};
+const kBad = {kind: 'error', message: 'boom'};
+
+%PrepareFunctionForOptimization(handle);
+handle(kGood);
+handle(kBad);
+%OptimizeFunctionOnNextCall(handle);
+handle(kGood);
+
+// Once the profile is complete, an interrupt tick deoptimizes the
+// instrumented code and the next call lays out the function from the profile.
+// Later versions are never instrumented again.
+let total = 0;
+for (let i = 0; i < 1000000; i++) total += handle(kGood);
+print(total);
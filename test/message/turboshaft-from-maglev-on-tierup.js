@@ -0,0 +1,33 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --turboshaft-from-maglev-on-tierup
+// Flags: --trace-turboshaft-from-maglev --maglev --turbofan
+// Flags: --no-always-turbofan --no-always-sparkplug
+
+function fromMaglev(o, n) {
+  let s = 0;
+  for (let i = 0; i < n; i++) {
+    s += o.x * i;
+  }
+  return s;
+}
+
+function fromBytecode(o) {
+  return o.x + 1;
+}
+
+// Functions that tier up from Maglev use the Maglev frontend.
+%PrepareFunctionForOptimization(fromMaglev);
+fromMaglev({x: 3}, 5);
+%OptimizeMaglevOnNextCall(fromMaglev);
+fromMaglev({x: 3}, 5);
+%OptimizeFunctionOnNextCall(fromMaglev);
+print(fromMaglev({x: 3}, 5));
+
+// Functions that go straight to Turbofan do not.
+%PrepareFunctionForOptimization(fromBytecode);
+fromBytecode({x: 3});
+%OptimizeFunctionOnNextCall(fromBytecode);
+print(fromBytecode({x: 3}));
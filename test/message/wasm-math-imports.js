@@ -0,0 +1,30 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --trace-wasm-inlining --liftoff
+// Disable inlining, so that only the lowering of the imports is traced, and
+// debug code to avoid differences between debug and release builds.
+// Flags: --no-wasm-inlining --no-debug-code --turboshaft-wasm
+
+d8.file.execute('test/mjsunit/wasm/wasm-module-builder.js');
+
+let builder = new WasmModuleBuilder();
+let sin = builder.addImport('Math', 'sin', kSig_d_d);
+let imul = builder.addImport('Math', 'imul', kSig_i_ii);
+// Math.sin does not behave like an i32 operator, so this import stays a call.
+let sin_i32 = builder.addImport('Math', 'sinI32', kSig_i_i);
+
+builder.addFunction('main', kSig_d_ii).exportFunc().addBody([
+  kExprLocalGet, 0, kExprLocalGet, 1, kExprCallFunction, imul,
+  kExprCallFunction, sin_i32,
+  kExprF64SConvertI32,
+  kExprCallFunction, sin,
+]);
+
+let instance = builder.instantiate({
+  Math: {sin: Math.sin, imul: Math.imul, sinI32: Math.sin},
+});
+print(instance.exports.main(0, 7));
+%WasmTierUpFunction(instance.exports.main);
+print(instance.exports.main(0, 7));
@@ -0,0 +1,39 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --turbofan --no-always-turbofan
+// Flags: --turbo-profile-guided-block-layout
+
+function handle(request) {
+  if (request.kind === 'error') {
+    return 'error: ' + request.message;
+  }
+  let total = 0;
+  for (let i = 0; i < request.items.length; i++) {
+    total += request.items[i];
+  }
+  return total;
+}
+
+const kGood = {kind: 'ok', items: [1, 2, 3]};
+const kBad = {kind: 'error', message: 'boom'};
+
+%PrepareFunctionForOptimization(handle);
+assertEquals(6, handle(kGood));
+assertEquals('error: boom', handle(kBad));
+
+// The first optimized version collects block counters.
+%OptimizeFunctionOnNextCall(handle);
+assertEquals(6, handle(kGood));
+for (let i = 0; i < 1000; i++) assertEquals(6, handle(kGood));
+assertEquals('error: boom', handle(kBad));
+
+// Re-optimizing lays out the rarely taken error path as cold code, which must
+// not change behavior.
+%DeoptimizeFunction(handle);
+%PrepareFunctionForOptimization(handle);
+%OptimizeFunctionOnNextCall(handle);
+assertEquals(6, handle(kGood));
+assertEquals('error: boom', handle(kBad));
+for (let i = 0; i < 100; i++) assertEquals(6, handle(kGood));
@@ -0,0 +1,66 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --json-parse-map-cache
+
+(function TestSameKeysAcrossCalls() {
+  const a = JSON.parse('{"id": 1, "name": "a", "nested": {"x": 1, "y": 2}}');
+  const b = JSON.parse('{"id": 2, "name": "b", "nested": {"x": 3, "y": 4}}');
+  assertTrue(%HaveSameMap(a, b));
+  assertTrue(%HaveSameMap(a.nested, b.nested));
+  assertEquals({id: 2, name: 'b', nested: {x: 3, y: 4}}, b);
+})();
+
+(function TestDifferentKeysWithSameHash() {
+  // Keys that agree in length and first and last characters share a cache
+  // entry; the cached map must not be used for them.
+  const a = JSON.parse('{"abc": 1, "xyz": 2}');
+  const b = JSON.parse('{"axc": 3, "xbz": 4}');
+  assertFalse(%HaveSameMap(a, b));
+  assertEquals(['abc', 'xyz'], Object.keys(a));
+  assertEquals(['axc', 'xbz'], Object.keys(b));
+  assertEquals({axc: 3, xbz: 4}, b);
+  const c = JSON.parse('{"abc": 5, "xyz": 6}');
+  assertEquals({abc: 5, xyz: 6}, c);
+})();
+
+(function TestFieldRepresentationChanges() {
+  const values = ['1', '1.5', '"s"', 'null', '{"p": 1}', '[1]', 'true', '2'];
+  let objects = [];
+  for (let v of values) {
+    objects.push(JSON.parse(`{"field": ${v}, "other": ${v}}`));
+  }
+  for (let i = 0; i < values.length; i++) {
+    assertEquals(JSON.parse(values[i]), objects[i].field);
+    assertEquals(JSON.parse(values[i]), objects[i].other);
+  }
+})();
+
+(function TestMapsAreContextSpecific() {
+  const json = '{"realm": 1, "key": 2}';
+  const local = JSON.parse(json);
+  const realm = Realm.create();
+  const remote = Realm.eval(realm, `JSON.parse('${json}')`);
+  assertSame(Object.prototype, Object.getPrototypeOf(local));
+  assertSame(Realm.eval(realm, 'Object.prototype'),
+             Object.getPrototypeOf(remote));
+  assertEquals(JSON.parse(json), JSON.parse(json));
+})();
+
+(function TestElementsAndNamedProperties() {
+  const a = JSON.parse('{"0": "x", "k": 1}');
+  const b = JSON.parse('{"k": 2}');
+  assertEquals({0: 'x', k: 1}, a);
+  assertEquals({k: 2}, b);
+  assertEquals(['k'], Object.keys(b));
+})();
+
+(function TestCacheClearedByGC() {
+  const a = JSON.parse('{"gc": 1}');
+  // Clears the cache; the map is found through its transition again.
+  gc();
+  const b = JSON.parse('{"gc": 2}');
+  assertTrue(%HaveSameMap(a, b));
+  assertEquals(2, b.gc);
+})();
@@ -0,0 +1,87 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --json-parse-parallel --json-parse-parallel-min-length=0
+
+function MakeRecords(count) {
+  const records = [];
+  for (let i = 0; i < count; i++) {
+    records.push({
+      id: i,
+      name: 'record' + i,
+      score: i / 7,
+      active: i % 2 == 0,
+      parent: i % 3 == 0 ? null : i - 1,
+      tags: ['a', 'b' + i],
+      nested: {depth: {value: -i}},
+    });
+  }
+  return records;
+}
+
+(function TestRecords() {
+  const records = MakeRecords(1000);
+  const text = JSON.stringify(records);
+  assertEquals(records, JSON.parse(text));
+  assertEquals(records, JSON.parse(JSON.stringify(records, null, 2)));
+})();
+
+(function TestSiblingsShareMaps() {
+  const parsed = JSON.parse(JSON.stringify(MakeRecords(100)));
+  for (let i = 1; i < parsed.length; i++) {
+    assertEquals(Object.keys(parsed[0]), Object.keys(parsed[i]));
+  }
+})();
+
+(function TestValues() {
+  const values = [
+    0, 1, -1, 123456789, 1234567890, -2147483649, 0.5, -1.5e-7, 1e300, 1000,
+    200, '', 'short', 'a longer string value', 'é', '€uro', true, false, null,
+    [], {}, [[]], [{}], {a: []}, {'': 1}, {a: 1, a2: {b: [1, 'x']}},
+  ];
+  assertEquals(values, JSON.parse(JSON.stringify(values)));
+  const parsed = JSON.parse('[-0, 1E3, 2e+2, 0.0, -0.0e0]');
+  assertEquals([-0, 1000, 200, 0, -0], parsed);
+  assertEquals(-Infinity, 1 / parsed[0]);
+  assertEquals(-Infinity, 1 / parsed[4]);
+})();
+
+(function TestEscapes() {
+  const text = '["a\\"b", "\\\\", "\\/", "\\b\\f\\n\\r\\t", "\\u0041\\u20ac",' +
+               ' "x\\ud83d\\ude00y", "\\udc00"]';
+  assertEquals(['a"b', '\\', '/', '\b\f\n\r\t', 'A€', 'x😀y', '\udc00'],
+               JSON.parse(text));
+})();
+
+(function TestFallback() {
+  // Keys with escapes, index keys, duplicate keys and deep nesting are left
+  // to the sequential parser, or handled like it.
+  assertEquals([{a: 1}, {'a\n': 2}], JSON.parse('[{"a":1},{"a\\n":2}]'));
+  assertEquals([{0: 'x', b: 1}, {1: 'y'}],
+               JSON.parse('[{"0":"x","b":1},{"1":"y"}]'));
+  assertEquals([{a: 2}, 1], JSON.parse('[{"a":1,"a":2},1]'));
+  const deep = '['.repeat(500) + ']'.repeat(500);
+  assertEquals(JSON.parse(deep), JSON.parse(`[${deep},${deep}]`)[0]);
+  assertEquals({a: [1, 2]}, JSON.parse('{"a":[1,2]}'));
+  assertEquals(1, JSON.parse('1'));
+  assertEquals([], JSON.parse('[]'));
+  assertEquals([1], JSON.parse(' [ 1 ] '));
+})();
+
+(function TestReviver() {
+  assertEquals([2, 4], JSON.parse('[1,2]', (key, value) =>
+      typeof value === 'number' ? value * 2 : value));
+})();
+
+(function TestErrors() {
+  const invalid = [
+    '[1,]', '[,1]', '[1 2]', '[1,2', '[1,2]]', '[1,2] x', '[01,2]', '[1,-]',
+    '[1.,2]', '[1e,2]', '[tru,1]', '[nul,1]', '["a\nb",1]', '["\\x",1]',
+    '["\\u12",1]', '[{"a" 1},1]', '[{"a":1,},1]', '[{a:1},1]', '[1,"a]',
+    '[1,{]', '[1,}]', '[1,[}]', '[1,{"a":[}]',
+  ];
+  for (const text of invalid) {
+    assertThrows(() => JSON.parse(text), SyntaxError);
+  }
+})();
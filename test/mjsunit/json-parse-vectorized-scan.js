@@ -0,0 +1,63 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Strings and whitespace runs are scanned a vector at a time. Place special
+// characters at every offset relative to the vector boundaries.
+
+const kMaxLength = 70;
+
+function TestStrings(filler) {
+  for (let length = 0; length < kMaxLength; length++) {
+    const plain = filler.repeat(length);
+    assertEquals(plain, JSON.parse(`"${plain}"`));
+    assertEquals([plain, plain], JSON.parse(`["${plain}","${plain}"]`));
+    for (let pos = 0; pos <= length; pos++) {
+      const prefix = plain.substring(0, pos);
+      const suffix = plain.substring(pos);
+      for (let [escape, value] of [['\\"', '"'], ['\\\\', '\\'],
+                                   ['\\n', '\n'], ['\\u00e9', 'é'],
+                                   ['\\u20ac', '€']]) {
+        const expected = prefix + value + suffix;
+        assertEquals(expected, JSON.parse(`"${prefix}${escape}${suffix}"`));
+        assertEquals({[expected]: expected},
+                     JSON.parse(`{"${prefix}${escape}${suffix}":` +
+                                `"${prefix}${escape}${suffix}"}`));
+      }
+      // Unescaped control characters are illegal.
+      assertThrows(() => JSON.parse(`"${prefix}\n${suffix}"`), SyntaxError);
+      assertThrows(() => JSON.parse(`"${prefix}\x01${suffix}"`), SyntaxError);
+    }
+    // Unterminated strings.
+    assertThrows(() => JSON.parse(`"${plain}`), SyntaxError);
+  }
+}
+
+TestStrings('a');
+TestStrings('é');  // Latin1, but not ASCII.
+TestStrings('€');  // Two-byte.
+
+(function TestTwoByteSourceWithOneByteStrings() {
+  // A two-byte source where some strings fit into one-byte strings and others
+  // don't; the characters of the latter must not leak into the former.
+  for (let length = 0; length < kMaxLength; length++) {
+    const one_byte = 'x'.repeat(length);
+    const two_byte = '€'.repeat(length);
+    const result = JSON.parse(
+        `["${one_byte}","${two_byte}","${one_byte}ÿ"]`);
+    assertEquals([one_byte, two_byte, one_byte + 'ÿ'], result);
+  }
+})();
+
+(function TestWhitespaceRuns() {
+  for (let length = 0; length < kMaxLength; length++) {
+    for (let ws of [' ', '\t', '\r', '\n', ' \n\t\r']) {
+      const run = ws.repeat(length);
+      assertEquals({a: [1, 'b']},
+                   JSON.parse(`${run}{${run}"a"${run}:${run}[${run}1${run},` +
+                              `${run}"b"${run}]${run}}${run}`));
+      assertThrows(() => JSON.parse(`${run}{${run}"a"${run}:${run}x}`),
+                   SyntaxError);
+    }
+  }
+})();
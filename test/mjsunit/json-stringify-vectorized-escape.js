@@ -0,0 +1,71 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Strings are scanned for characters to escape a vector at a time. Place such
+// characters at every offset relative to the vector boundaries.
+
+const kMaxLength = 70;
+
+function Escape(s) {
+  let result = '"';
+  for (let i = 0; i < s.length; i++) {
+    const c = s.charCodeAt(i);
+    if (c == 0x22) {
+      result += '\\"';
+    } else if (c == 0x5c) {
+      result += '\\\\';
+    } else if (c == 0x0a) {
+      result += '\\n';
+    } else if (c < 0x20) {
+      result += '\\u' + c.toString(16).padStart(4, '0');
+    } else if (c >= 0xd800 && c <= 0xdbff && i + 1 < s.length &&
+               s.charCodeAt(i + 1) >= 0xdc00 && s.charCodeAt(i + 1) <= 0xdfff) {
+      result += s[i] + s[i + 1];
+      i++;
+    } else if (c >= 0xd800 && c <= 0xdfff) {
+      result += '\\u' + c.toString(16);
+    } else {
+      result += s[i];
+    }
+  }
+  return result + '"';
+}
+
+function TestStrings(filler) {
+  for (let length = 0; length < kMaxLength; length++) {
+    const plain = filler.repeat(length);
+    assertEquals(Escape(plain), JSON.stringify(plain));
+    for (let pos = 0; pos <= length; pos++) {
+      const prefix = plain.substring(0, pos);
+      const suffix = plain.substring(pos);
+      for (let special of ['"', '\\', '\n', '\x01', '\x1f', '\ud800',
+                           '\udfff', '😀', '\ude00\ud83d']) {
+        const s = prefix + special + suffix;
+        assertEquals(Escape(s), JSON.stringify(s));
+        assertEquals(`{${Escape(s)}:[${Escape(s)}]}`,
+                     JSON.stringify({[s]: [s]}));
+      }
+    }
+  }
+}
+
+TestStrings('a');
+TestStrings('é');  // Latin1, but not ASCII.
+TestStrings('€');  // Two-byte.
+
+(function TestLongStrings() {
+  // Strings too long for the pessimistic length estimate, appended to
+  // partially filled output.
+  for (let filler of ['a', '€']) {
+    for (let length of [16 * 1024, 40000, 100000]) {
+      for (let special of ['', '"', '\n', '\ud800', '😀']) {
+        const dense = special.repeat(length / 16);
+        const s = filler.repeat(length) + special + dense;
+        assertEquals(Escape(s), JSON.stringify(s));
+        assertEquals(`["x",${Escape(s)},${Escape(s)}]`,
+                     JSON.stringify(['x', s, s]));
+      }
+    }
+  }
+})();
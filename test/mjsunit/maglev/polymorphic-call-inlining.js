@@ -0,0 +1,50 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --maglev --no-turbofan
+// Flags: --maglev-polymorphic-inlining
+
+function add(a, b) { return a + b; }
+function sub(a, b) { return a - b; }
+function mul(a, b) { return a * b; }
+
+function apply(op, a, b) {
+  let f = op == 0 ? add : (op == 1 ? sub : mul);
+  return f(a, b);
+}
+
+%PrepareFunctionForOptimization(add);
+%PrepareFunctionForOptimization(sub);
+%PrepareFunctionForOptimization(mul);
+%PrepareFunctionForOptimization(apply);
+assertEquals(5, apply(0, 2, 3));
+assertEquals(-1, apply(1, 2, 3));
+assertEquals(6, apply(2, 2, 3));
+%OptimizeMaglevOnNextCall(apply);
+assertEquals(5, apply(0, 2, 3));
+assertEquals(-1, apply(1, 2, 3));
+assertEquals(6, apply(2, 2, 3));
+assertTrue(isMaglevved(apply));
+
+// Deopts inside one of the inlined arms.
+assertEquals("ab", apply(0, "a", "b"));
+assertEquals(1.5, apply(2, 0.5, 3));
+
+// Polymorphic method calls, where the loaded target is a phi of constants.
+class A { visit(x) { return x + 1; } }
+class B { visit(x) { return x + 2; } }
+
+function visitAll(nodes) {
+  let sum = 0;
+  for (let node of nodes) sum += node.visit(1);
+  return sum;
+}
+
+let nodes = [new A(), new B(), new A(), new B()];
+%PrepareFunctionForOptimization(visitAll);
+assertEquals(10, visitAll(nodes));
+assertEquals(10, visitAll(nodes));
+%OptimizeMaglevOnNextCall(visitAll);
+assertEquals(10, visitAll(nodes));
+assertTrue(isMaglevved(visitAll));
@@ -0,0 +1,30 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --maglev --no-turbofan
+// Flags: --maglev-cost-aware-register-eviction
+
+// Keep more values live across the loop than there are registers, so that
+// the allocator has to evict some of them.
+function f(a, n) {
+  let x0 = a[0], x1 = a[1], x2 = a[2], x3 = a[3], x4 = a[4], x5 = a[5];
+  let x6 = a[6], x7 = a[7], x8 = a[8], x9 = a[9], x10 = a[10], x11 = a[11];
+  let x12 = a[12], x13 = a[13], x14 = a[14], x15 = a[15];
+  let s = 0;
+  for (let i = 0; i < n; i++) {
+    s += x0 * i + x1 - x2 + x3 * x4 - x5 + x6 + x7 * x8 - x9 + x10;
+    s += x11 + x12 * x13 - x14 + x15 + 0.5;
+  }
+  return s + x0 + x15;
+}
+
+let a = [];
+for (let i = 0; i < 16; i++) a.push(i + 0.25);
+
+%PrepareFunctionForOptimization(f);
+let expected = f(a, 10);
+f(a, 10);
+%OptimizeMaglevOnNextCall(f);
+assertEquals(expected, f(a, 10));
+assertTrue(isMaglevved(f));
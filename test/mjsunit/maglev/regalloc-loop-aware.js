@@ -0,0 +1,36 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --maglev --no-turbofan
+// Flags: --maglev-loop-aware-regalloc
+
+// Values used after the loop only compete for registers with values that are
+// used in every iteration, before and after a call.
+function f(a, n, g) {
+  let y0 = a[0] * 2, y1 = a[1] * 2, y2 = a[2] * 2, y3 = a[3] * 2;
+  let y4 = a[4] * 2, y5 = a[5] * 2, y6 = a[6] * 2, y7 = a[7] * 2;
+  let x0 = a[8], x1 = a[9], x2 = a[10], x3 = a[11];
+  let x4 = a[12], x5 = a[13], x6 = a[14], x7 = a[15];
+  let s = 0;
+  for (let i = 0; i < n; i++) {
+    s += x0 * i + x1 - x2 + x3 * x4 - x5 + x6 * x7;
+    s += g(i);
+    s -= x0 + x1 * x2 - x3 + x4 * x5 - x6 + x7;
+  }
+  return s + y0 + y1 + y2 + y3 + y4 + y5 + y6 + y7;
+}
+
+function g(i) {
+  return i & 3;
+}
+
+let a = [];
+for (let i = 0; i < 16; i++) a.push(i + 0.25);
+
+%PrepareFunctionForOptimization(f);
+let expected = f(a, 10, g);
+f(a, 10, g);
+%OptimizeMaglevOnNextCall(f);
+assertEquals(expected, f(a, 10, g));
+assertTrue(isMaglevved(f));
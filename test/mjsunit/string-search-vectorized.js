@@ -0,0 +1,91 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// String searches scan for the first and last character of the pattern a
+// vector at a time. Place matches and near misses at every offset relative to
+// the vector boundaries, for all combinations of one-byte and two-byte
+// subjects and patterns.
+
+const kMaxLength = 80;
+
+function ReferenceIndexOf(subject, pattern, from) {
+  for (let i = from; i + pattern.length <= subject.length; i++) {
+    if (subject.substr(i, pattern.length) === pattern) return i;
+  }
+  return -1;
+}
+
+function TestPattern(filler, pattern) {
+  // A near miss matches the first and last character only, or just the first
+  // character of a two-character pattern.
+  const near_miss = pattern.length > 2 ?
+      pattern[0] + filler.repeat(pattern.length - 2) +
+          pattern[pattern.length - 1] :
+      pattern.slice(0, -1);
+  for (let pos = 0; pos < kMaxLength; pos++) {
+    const prefix = filler.repeat(pos);
+    const subject = prefix + near_miss + filler + pattern + filler.repeat(3);
+    const expected = ReferenceIndexOf(subject, pattern, 0);
+    assertEquals(expected, subject.indexOf(pattern));
+    assertTrue(subject.includes(pattern));
+    assertEquals(-1, subject.indexOf(pattern, expected + 1));
+    assertEquals(expected, subject.lastIndexOf(pattern));
+    assertEquals([subject.substring(0, expected),
+                  subject.substring(expected + pattern.length)],
+                 subject.split(pattern));
+    assertEquals(subject.substring(0, expected) + '#' +
+                     subject.substring(expected + pattern.length),
+                 subject.replaceAll(pattern, '#'));
+    // The pattern at the very end of the subject.
+    assertEquals(prefix.length, (prefix + pattern).indexOf(pattern));
+    // A subject that ends just before the last character of the pattern.
+    assertFalse((prefix + pattern.slice(0, -1)).includes(pattern));
+  }
+}
+
+const kPatterns = [
+  'x', 'xy', 'xyz', 'x!!!!y', 'xyxyxyxz', 'x' + '-'.repeat(30) + 'y', '€',
+  '€x', 'x€', '€€€€€€€€', '\0', '\0\0',
+];
+for (const filler of ['a', 'é', '€', 'Ā', 'xĀ']) {
+  for (const pattern of kPatterns) {
+    if ([...filler].some(c => pattern.includes(c))) continue;
+    TestPattern(filler, pattern);
+  }
+}
+
+(function TestTwoByteSubjectOneBytePatternBytes() {
+  // Characters whose low or high byte equals a one-byte pattern character
+  // must not match it.
+  const misses = 'Ÿ砀'.repeat(20);
+  assertEquals(-1, misses.indexOf('x'));
+  assertEquals(-1, misses.indexOf('xx'));
+  assertEquals([misses], misses.split('x'));
+  const subject = misses + 'x' + misses;
+  assertEquals(40, subject.indexOf('x'));
+  assertEquals(40, subject.indexOf('xŸ砀'));
+  assertEquals([misses, misses], subject.split('x'));
+})();
+
+(function TestTwoBytePatternInOneByteSubject() {
+  const subject = 'abc'.repeat(30);
+  assertEquals(-1, subject.indexOf('aŢ'));
+  assertEquals(-1, subject.indexOf('šbc'));
+  assertFalse(subject.includes('Ā'));
+})();
+
+(function TestManyCandidates() {
+  // The first character of the pattern matches everywhere.
+  for (let length of [2, 3, 7, 20]) {
+    const pattern = 'a'.repeat(length - 1) + 'b';
+    const subject = 'a'.repeat(1000) + 'b';
+    assertEquals(1000 - length + 1, subject.indexOf(pattern));
+  }
+  // The first and last character match at many positions, which makes longer
+  // patterns switch to Boyer-Moore.
+  for (let length of [3, 7, 20]) {
+    const wrapped = ('a' + 'x'.repeat(length - 2) + 'b').repeat(100);
+    assertEquals(-1, wrapped.indexOf('a' + 'y'.repeat(length - 2) + 'b'));
+  }
+})();
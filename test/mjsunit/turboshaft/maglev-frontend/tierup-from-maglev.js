@@ -0,0 +1,28 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --turboshaft-from-maglev-on-tierup
+// Flags: --maglev --turbofan
+
+function f(o, n) {
+  let s = 0;
+  for (let i = 0; i < n; i++) {
+    s += o.x * i;
+  }
+  return s;
+}
+
+%PrepareFunctionForOptimization(f);
+assertEquals(30, f({x: 3}, 5));
+%OptimizeMaglevOnNextCall(f);
+assertEquals(30, f({x: 3}, 5));
+assertTrue(isMaglevved(f));
+
+// Tiering up from Maglev builds the Turboshaft graph from Maglev.
+%OptimizeFunctionOnNextCall(f);
+assertEquals(30, f({x: 3}, 5));
+assertOptimized(f);
+
+// Deopts out of the Maglev-built Turbofan code still work.
+assertEquals(15, f({x: 1.5}, 5));
@@ -0,0 +1,150 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --no-liftoff
+
+d8.file.execute("test/mjsunit/wasm/wasm-module-builder.js");
+
+// Copies between numeric arrays call memmove directly. Overlapping copies in
+// both directions must behave like memmove.
+function BuildCopyModule(element_type, get_opcode) {
+  const builder = new WasmModuleBuilder();
+  const array = builder.addArray(element_type, true);
+  const global = builder.addGlobal(wasmRefNullType(array), true, false);
+  const value_type = element_type == kWasmI8 || element_type == kWasmI16
+      ? kWasmI32 : element_type;
+
+  builder.addFunction("init", makeSig([kWasmI32], []))
+    .addBody([
+      kExprLocalGet, 0, kGCPrefix, kExprArrayNewDefault, array,
+      kExprGlobalSet, global.index,
+    ])
+    .exportFunc();
+  builder.addFunction("set", makeSig([kWasmI32, value_type], []))
+    .addBody([
+      kExprGlobalGet, global.index, kExprLocalGet, 0, kExprLocalGet, 1,
+      kGCPrefix, kExprArraySet, array,
+    ])
+    .exportFunc();
+  builder.addFunction("get", makeSig([kWasmI32], [value_type]))
+    .addBody([
+      kExprGlobalGet, global.index, kExprLocalGet, 0,
+      kGCPrefix, get_opcode, array,
+    ])
+    .exportFunc();
+  builder.addFunction("copy", makeSig([kWasmI32, kWasmI32, kWasmI32], []))
+    .addBody([
+      kExprGlobalGet, global.index, kExprLocalGet, 0,
+      kExprGlobalGet, global.index, kExprLocalGet, 1,
+      kExprLocalGet, 2,
+      kGCPrefix, kExprArrayCopy, array, array,
+    ])
+    .exportFunc();
+  return builder.instantiate().exports;
+}
+
+function TestOverlappingCopies(element_type, get_opcode, make_value) {
+  const wasm = BuildCopyModule(element_type, get_opcode);
+  const kLength = 180;
+  const lengths = [0, 1, 3, 7, 8, 9, 15, 16, 17, 33, 40, 41, 80, 81, 160, 161];
+  const offsets = [[0, 0], [0, 5], [5, 0], [3, 4], [4, 3], [0, 17], [17, 1]];
+  for (const length of lengths) {
+    for (const [dst, src] of offsets) {
+      wasm.init(kLength);
+      const expected = [];
+      for (let i = 0; i < kLength; i++) {
+        expected.push(make_value(i));
+        wasm.set(i, expected[i]);
+      }
+      wasm.copy(dst, src, length);
+      expected.copyWithin(dst, src, src + length);
+      for (let i = 0; i < kLength; i++) {
+        assertEquals(expected[i], wasm.get(i));
+      }
+    }
+  }
+}
+
+(function TestArrayCopyOverlappingI8() {
+  print(arguments.callee.name);
+  TestOverlappingCopies(kWasmI8, kExprArrayGetU, i => (i * 7 + 1) & 0xff);
+})();
+
+(function TestArrayCopyOverlappingI16() {
+  print(arguments.callee.name);
+  TestOverlappingCopies(kWasmI16, kExprArrayGetU, i => (i * 1031 + 1) & 0xffff);
+})();
+
+(function TestArrayCopyOverlappingI32() {
+  print(arguments.callee.name);
+  TestOverlappingCopies(kWasmI32, kExprArrayGet, i => (i * 0x01010101) | 0);
+})();
+
+(function TestArrayCopyOverlappingF64() {
+  print(arguments.callee.name);
+  TestOverlappingCopies(kWasmF64, kExprArrayGet, i => i + 0.5);
+})();
+
+(function TestArrayCopyInvalidatesLoads() {
+  print(arguments.callee.name);
+  const builder = new WasmModuleBuilder();
+  const array = builder.addArray(kWasmI32, true);
+  // Reads dst[i] before and after copying 4 elements of src to dst[i], and
+  // returns the difference. The copy must not be hidden from load elimination.
+  builder.addFunction("copyBetweenReads",
+                      makeSig([wasmRefType(array), wasmRefType(array),
+                               kWasmI32], [kWasmI32]))
+    .addLocals(kWasmI32, 1)
+    .addBody([
+      kExprLocalGet, 0, kExprLocalGet, 2, kGCPrefix, kExprArrayGet, array,
+      kExprLocalSet, 3,
+      kExprLocalGet, 0, kExprLocalGet, 2, kExprLocalGet, 1, kExprI32Const, 0,
+      kExprI32Const, 4, kGCPrefix, kExprArrayCopy, array, array,
+      kExprLocalGet, 0, kExprLocalGet, 2, kGCPrefix, kExprArrayGet, array,
+      kExprLocalGet, 3, kExprI32Sub,
+    ])
+    .exportFunc();
+  builder.addFunction("newArray", makeSig([kWasmI32], [wasmRefType(array)]))
+    .addBody([
+      kExprLocalGet, 0, kExprI32Const, 8, kGCPrefix, kExprArrayNew, array,
+    ])
+    .exportFunc();
+  const wasm = builder.instantiate().exports;
+
+  for (let i = 0; i < 4; i++) {
+    const dst = wasm.newArray(1);
+    const src = wasm.newArray(11);
+    assertEquals(10, wasm.copyBetweenReads(dst, src, i));
+  }
+})();
+
+(function TestArrayInitDataI32() {
+  print(arguments.callee.name);
+  const builder = new WasmModuleBuilder();
+  const array = builder.addArray(kWasmI32, true);
+  const bytes = [];
+  for (let i = 0; i < 64; i++) bytes.push(i);
+  const segment = builder.addPassiveDataSegment(bytes);
+
+  builder.addFunction("init", makeSig([kWasmI32, kWasmI32, kWasmI32],
+                                      [kWasmI32]))
+    .addLocals(wasmRefNullType(array), 1)
+    .addBody([
+      ...wasmI32Const(16), kGCPrefix, kExprArrayNewDefault, array,
+      kExprLocalSet, 3,
+      kExprLocalGet, 3, kExprLocalGet, 0, kExprLocalGet, 1, kExprLocalGet, 2,
+      kGCPrefix, kExprArrayInitData, array, segment,
+      kExprLocalGet, 3, kExprLocalGet, 0, kGCPrefix, kExprArrayGet, array,
+    ])
+    .exportFunc();
+  const wasm = builder.instantiate().exports;
+
+  assertEquals(0x03020100, wasm.init(0, 0, 16));
+  assertEquals(0x3f3e3d3c, wasm.init(15, 60, 1));
+  assertEquals(0x04030201, wasm.init(2, 1, 3));
+  assertTraps(kTrapArrayOutOfBounds, () => wasm.init(15, 0, 2));
+  assertTraps(kTrapArrayOutOfBounds, () => wasm.init(0, 0, 0x80000000));
+  assertTraps(kTrapDataSegmentOutOfBounds, () => wasm.init(0, 61, 1));
+  assertTraps(kTrapDataSegmentOutOfBounds, () => wasm.init(0, 65, 0));
+})();
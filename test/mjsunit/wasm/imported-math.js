@@ -0,0 +1,98 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --no-liftoff --turboshaft-wasm
+
+d8.file.execute('test/mjsunit/wasm/wasm-module-builder.js');
+
+const kUnaryF64 = ['abs', 'acos', 'asin', 'atan', 'ceil', 'cos', 'exp',
+                   'floor', 'log', 'sin', 'sqrt', 'tan', 'trunc'];
+const kBinaryF64 = ['atan2', 'max', 'min', 'pow'];
+const kUnaryI32 = ['clz32'];
+const kBinaryI32 = ['imul'];
+
+const kF64Inputs = [0, -0, 0.5, -0.5, 1, -1, 1.5, -2.5, Math.PI, 1e300,
+                    -1e-300, Infinity, -Infinity, NaN];
+const kI32Inputs = [0, 1, -1, 7, 0x7fffffff, -0x80000000, 0x12345678];
+
+function MakeModule() {
+  let builder = new WasmModuleBuilder();
+  function add(names, sig, param_count) {
+    for (let name of names) {
+      let imp = builder.addImport('Math', name, sig);
+      let body = [];
+      for (let i = 0; i < param_count; i++) body.push(kExprLocalGet, i);
+      body.push(kExprCallFunction, imp);
+      builder.addFunction(name, sig).exportFunc().addBody(body);
+    }
+  }
+  add(kUnaryF64, kSig_d_d, 1);
+  add(kBinaryF64, kSig_d_dd, 2);
+  add(kUnaryI32, kSig_i_i, 1);
+  add(kBinaryI32, kSig_i_ii, 2);
+  return new WebAssembly.Module(builder.toBuffer());
+}
+
+function TierUp(instance) {
+  for (let name of Object.keys(instance.exports)) {
+    %WasmTierUpFunction(instance.exports[name]);
+  }
+}
+
+function CheckAll(instance, reference) {
+  for (let name of kUnaryF64) {
+    for (let a of kF64Inputs) {
+      assertEquals(reference[name](a), instance.exports[name](a), name);
+    }
+  }
+  for (let name of kBinaryF64) {
+    for (let a of kF64Inputs) {
+      for (let b of kF64Inputs) {
+        assertEquals(reference[name](a, b), instance.exports[name](a, b),
+                     name);
+      }
+    }
+  }
+  for (let name of kUnaryI32) {
+    for (let a of kI32Inputs) {
+      assertEquals(reference[name](a), instance.exports[name](a), name);
+    }
+  }
+  for (let name of kBinaryI32) {
+    for (let a of kI32Inputs) {
+      for (let b of kI32Inputs) {
+        assertEquals(reference[name](a, b) | 0, instance.exports[name](a, b),
+                     name);
+      }
+    }
+  }
+}
+
+let module = MakeModule();
+
+(function TestMathImports() {
+  print(arguments.callee.name);
+  let instance = new WebAssembly.Instance(module, {Math});
+  CheckAll(instance, Math);
+  TierUp(instance);
+  CheckAll(instance, Math);
+})();
+
+(function TestMathImportsInvalidated() {
+  print(arguments.callee.name);
+  // Instantiating the same module with different functions must invalidate
+  // the specialized code.
+  let counter = 0;
+  let other = {};
+  for (let name of [...kUnaryF64, ...kBinaryF64]) {
+    other[name] = (a, b) => (counter++, Math[name](a, b) + 1);
+  }
+  for (let name of [...kUnaryI32, ...kBinaryI32]) {
+    other[name] = (a, b) => (counter++, Math[name](a, b) ^ 1);
+  }
+  let instance = new WebAssembly.Instance(module, {Math: other});
+  TierUp(instance);
+  CheckAll(instance, other);
+  assertTrue(counter > 0);
+})();
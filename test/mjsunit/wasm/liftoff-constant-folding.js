@@ -0,0 +1,101 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --liftoff --no-wasm-tier-up
+// Flags: --no-wasm-lazy-compilation
+
+d8.file.execute('test/mjsunit/wasm/wasm-module-builder.js');
+
+(function testI32ConstantFolding() {
+  print(arguments.callee.name);
+  const builder = new WasmModuleBuilder();
+  const tests = [
+    ['add', kExprI32Add, 0x7fffffff, 1, -0x80000000],
+    ['sub', kExprI32Sub, -0x80000000, 1, 0x7fffffff],
+    ['and', kExprI32And, 0x0ff0, 0x00ff, 0x00f0],
+    ['or', kExprI32Ior, 0x0f00, 0x00f0, 0x0ff0],
+    ['xor', kExprI32Xor, -1, 0x0f0f, -0x0f10],
+    ['shl', kExprI32Shl, 1, 33, 2],
+    ['shl_overflow', kExprI32Shl, 3, 31, -0x80000000],
+    ['shr_s', kExprI32ShrS, -16, 2, -4],
+    ['shr_u', kExprI32ShrU, -16, 28, 15],
+    ['shr_u_masked', kExprI32ShrU, -1, 32, -1],
+  ];
+  for (const [name, op, lhs, rhs] of tests) {
+    builder.addFunction(name, kSig_i_v)
+        .addBody([...wasmI32Const(lhs), ...wasmI32Const(rhs), op])
+        .exportFunc();
+  }
+  const instance = builder.instantiate();
+  for (const [name, op, lhs, rhs, expected] of tests) {
+    assertTrue(%IsLiftoffFunction(instance.exports[name]));
+    assertEquals(expected, instance.exports[name](), name);
+  }
+})();
+
+(function testI64ConstantFolding() {
+  print(arguments.callee.name);
+  const builder = new WasmModuleBuilder();
+  const tests = [
+    ['add', kExprI64Add, 0x7fffffff, 1, 0x80000000n],
+    ['sub', kExprI64Sub, -0x80000000, 1, -0x80000001n],
+    ['and', kExprI64And, -1, 0x7fff, 0x7fffn],
+    ['or', kExprI64Ior, -0x10000, 0xffff, -1n],
+    ['xor', kExprI64Xor, 0x40000000, 0x40000000, 0n],
+  ];
+  for (const [name, op, lhs, rhs] of tests) {
+    builder.addFunction(name, kSig_l_v)
+        .addBody([...wasmI64Const(lhs), ...wasmI64Const(rhs), op])
+        .exportFunc();
+  }
+  const instance = builder.instantiate();
+  for (const [name, op, lhs, rhs, expected] of tests) {
+    assertEquals(expected, instance.exports[name](), name);
+  }
+})();
+
+(function testConstantOperandWithRegister() {
+  print(arguments.callee.name);
+  const builder = new WasmModuleBuilder();
+  builder.addFunction('const_plus_param', kSig_i_i)
+      .addBody([...wasmI32Const(7), kExprLocalGet, 0, kExprI32Add])
+      .exportFunc();
+  builder.addFunction('const_minus_param', kSig_i_i)
+      .addBody([...wasmI32Const(7), kExprLocalGet, 0, kExprI32Sub])
+      .exportFunc();
+  builder.addFunction('param_minus_min_int', kSig_i_i)
+      .addBody([kExprLocalGet, 0, ...wasmI32Const(-0x80000000), kExprI32Sub])
+      .exportFunc();
+  builder.addFunction('param_minus_min_int64', kSig_l_l)
+      .addBody([kExprLocalGet, 0, ...wasmI64Const(-0x80000000), kExprI64Sub])
+      .exportFunc();
+  const instance = builder.instantiate();
+  assertEquals(10, instance.exports.const_plus_param(3));
+  assertEquals(4, instance.exports.const_minus_param(3));
+  assertEquals(-0x7ffffffd, instance.exports.param_minus_min_int(3));
+  assertEquals(0x80000003n, instance.exports.param_minus_min_int64(3n));
+})();
+
+(function testMultiValueMergeInRegisters() {
+  print(arguments.callee.name);
+  const builder = new WasmModuleBuilder();
+  const kSig_ii_v = builder.addType(makeSig([], [kWasmI32, kWasmI32]));
+  // Both arms of the {if} leave two values; the merge keeps them in registers
+  // if enough registers are free.
+  builder.addFunction('merge', kSig_ii_i)
+      .addBody([
+        kExprLocalGet, 0,
+        kExprIf, kSig_ii_v,
+          kExprLocalGet, 0, ...wasmI32Const(1), kExprI32Add,
+          ...wasmI32Const(10),
+        kExprElse,
+          ...wasmI32Const(20),
+          kExprLocalGet, 0, ...wasmI32Const(2), kExprI32Sub,
+        kExprEnd,
+      ])
+      .exportFunc();
+  const instance = builder.instantiate();
+  assertEquals([6, 10], instance.exports.merge(5));
+  assertEquals([20, -2], instance.exports.merge(0));
+})();
@@ -0,0 +1,109 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --experimental-wasm-memory64
+
+d8.file.execute('test/mjsunit/wasm/wasm-module-builder.js');
+
+// Accesses to a memory64 memory with a small offset only bounds check their
+// index against the maximum memory size; the offset is covered by a guard
+// region behind the memory.
+function BuildAccessModule(offsets) {
+  const builder = new WasmModuleBuilder();
+  builder.addMemory64(1, 2);
+  builder.exportMemoryAs('memory');
+  for (const offset of offsets) {
+    builder.addFunction(`load${offset}`, makeSig([kWasmF64], [kWasmI32]))
+        .addBody([
+          kExprLocalGet, 0,
+          kExprI64UConvertF64,
+          kExprI32LoadMem, 0, ...wasmUnsignedLeb(offset),
+        ])
+        .exportFunc();
+  }
+  builder.addFunction('grow', kSig_v_v)
+      .addBody([...wasmI64Const(1), kExprMemoryGrow, 0, kExprDrop])
+      .exportFunc();
+  // Sums the words at {index}, {index + 8} and {index + 16}, {count} times.
+  builder.addFunction('sum', makeSig([kWasmF64, kWasmI32], [kWasmI32]))
+      .addLocals(kWasmI64, 1)
+      .addLocals(kWasmI32, 1)
+      .addBody([
+        kExprLocalGet, 0,
+        kExprI64UConvertF64,
+        kExprLocalSet, 2,
+        kExprLoop, kWasmVoid,
+          kExprLocalGet, 3,
+          kExprLocalGet, 2, kExprI32LoadMem, 0, 0,
+          kExprI32Add,
+          kExprLocalGet, 2, kExprI32LoadMem, 0, 8,
+          kExprI32Add,
+          kExprLocalGet, 2, kExprI32LoadMem, 0, 16,
+          kExprI32Add,
+          kExprLocalSet, 3,
+          kExprLocalGet, 1, ...wasmI32Const(1), kExprI32Sub,
+          kExprLocalTee, 1,
+          kExprBrIf, 0,
+        kExprEnd,
+        kExprLocalGet, 3,
+      ])
+      .exportFunc();
+  return builder.instantiate().exports;
+}
+
+(function testSmallOffsets() {
+  print(arguments.callee.name);
+  const offsets = [0, 4, 100, 4096];
+  const exports = BuildAccessModule(offsets);
+  const view = new DataView(exports.memory.buffer);
+  const size = kPageSize;
+  view.setInt32(size - 4, 42, true);
+  for (const offset of offsets) {
+    const load = exports[`load${offset}`];
+    assertEquals(42, load(size - 4 - offset));
+    assertTraps(kTrapMemOutOfBounds, () => load(size - 3 - offset));
+    assertTraps(kTrapMemOutOfBounds, () => load(size - offset));
+    assertTraps(kTrapMemOutOfBounds, () => load(2 * size - 4 - offset));
+    assertTraps(kTrapMemOutOfBounds, () => load(2 * size));
+    assertTraps(kTrapMemOutOfBounds, () => load(2 ** 52));
+  }
+
+  // After growing, the second page is accessible; accesses that straddle the
+  // maximum size hit the guard region.
+  exports.grow();
+  const grown_view = new DataView(exports.memory.buffer);
+  grown_view.setInt32(2 * size - 4, 17, true);
+  for (const offset of offsets) {
+    const load = exports[`load${offset}`];
+    assertEquals(17, load(2 * size - 4 - offset));
+    assertTraps(kTrapMemOutOfBounds, () => load(2 * size - 3 - offset));
+    assertTraps(kTrapMemOutOfBounds, () => load(2 * size - offset));
+  }
+})();
+
+(function testOffsetBeyondInitialSize() {
+  print(arguments.callee.name);
+  const offset = kPageSize + 8;
+  const exports = BuildAccessModule([offset]);
+  const load = exports[`load${offset}`];
+  exports.grow();
+  new DataView(exports.memory.buffer).setInt32(offset, 7, true);
+  assertEquals(7, load(0));
+  assertTraps(kTrapMemOutOfBounds, () => load(kPageSize - 8));
+  assertTraps(kTrapMemOutOfBounds, () => load(2 * kPageSize - 4));
+})();
+
+(function testLoopInvariantIndex() {
+  print(arguments.callee.name);
+  const exports = BuildAccessModule([]);
+  const view = new DataView(exports.memory.buffer);
+  view.setInt32(64, 1, true);
+  view.setInt32(72, 2, true);
+  view.setInt32(80, 3, true);
+  assertEquals(60, exports.sum(64, 10));
+  view.setInt32(kPageSize - 4, 5, true);
+  assertEquals(10, exports.sum(kPageSize - 20, 2));
+  assertTraps(kTrapMemOutOfBounds, () => exports.sum(kPageSize - 16, 3));
+  assertTraps(kTrapMemOutOfBounds, () => exports.sum(2 * kPageSize - 4, 3));
+})();
@@ -0,0 +1,45 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --experimental-wasm-jspi
+// Flags: --wasm-stack-switching-stack-size=4
+// Flags: --experimental-wasm-growable-stacks
+// Flags: --stack-size=400 --wasm-stack-pool-size=64
+
+d8.file.execute("test/mjsunit/wasm/wasm-module-builder.js");
+
+// Stacks that are reused from the stack pool give their grown segments and
+// unused pages back to the OS. Alternate between deep and shallow recursions
+// on reused stacks and check that the results stay correct.
+(function TestReuseGrownStacks() {
+  print(arguments.callee.name);
+  const builder = new WasmModuleBuilder();
+  const wait = builder.addImport('m', 'wait', kSig_i_i);
+  const recurse = builder.addFunction('recurse', kSig_i_i);
+  recurse.addBody([
+    kExprLocalGet, 0,
+    kExprIf, kWasmI32,
+      kExprLocalGet, 0, kExprI32Const, 1, kExprI32Sub,
+      kExprCallFunction, recurse.index,
+      kExprI32Const, 1, kExprI32Add,
+    kExprElse,
+      kExprI32Const, 0, kExprCallFunction, wait,
+    kExprEnd,
+  ]);
+  builder.addFunction('test', kSig_i_i)
+    .addBody([kExprLocalGet, 0, kExprCallFunction, recurse.index])
+    .exportFunc();
+  const instance = builder.instantiate({m: {
+    wait: new WebAssembly.Suspending(x => Promise.resolve(x + 10))
+  }});
+  const test = WebAssembly.promising(instance.exports.test);
+
+  async function run() {
+    for (let i = 0; i < 20; i++) {
+      const depth = i % 2 ? 2 : 2000;
+      assertEquals(depth + 10, await test(depth));
+    }
+  }
+  assertPromiseResult(run());
+})();
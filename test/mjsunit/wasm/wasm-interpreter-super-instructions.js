@@ -0,0 +1,77 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --drumbrake-super-instructions
+
+d8.file.execute("test/mjsunit/wasm/wasm-module-builder.js");
+
+// Binary operators followed by local.set write their result directly into the
+// slot of the local.
+(function testBinopLocalSet() {
+  print(arguments.callee.name);
+  const builder = new WasmModuleBuilder();
+  builder.addFunction("accumulate", kSig_i_ii)
+    .addLocals(kWasmI32, 1)
+    .addBody([
+      kExprLoop, kWasmVoid,
+        // acc = acc + (i * 3)
+        kExprLocalGet, 2,
+        kExprLocalGet, 0, ...wasmI32Const(3), kExprI32Mul,
+        kExprI32Add,
+        kExprLocalSet, 2,
+        // acc = acc ^ (acc >> 3)
+        kExprLocalGet, 2,
+        kExprLocalGet, 2, ...wasmI32Const(3), kExprI32ShrU,
+        kExprI32Xor,
+        kExprLocalSet, 2,
+        // i = i + 1
+        kExprLocalGet, 0, ...wasmI32Const(1), kExprI32Add,
+        kExprLocalSet, 0,
+        kExprLocalGet, 0, kExprLocalGet, 1, kExprI32LtU,
+        kExprBrIf, 0,
+      kExprEnd,
+      kExprLocalGet, 2,
+    ])
+    .exportFunc();
+  builder.addFunction("shared_slot", kSig_i_ii)
+    .addBody([
+      // The old value of the local is still on the stack when it is
+      // overwritten.
+      kExprLocalGet, 0,
+      kExprLocalGet, 0, kExprLocalGet, 1, kExprI32Add,
+      kExprLocalSet, 0,
+      kExprLocalGet, 0,
+      kExprI32Sub,
+    ])
+    .exportFunc();
+  builder.addFunction("f64_mul", kSig_d_dd)
+    .addBody([
+      kExprLocalGet, 0, kExprLocalGet, 1, kExprF64Mul,
+      kExprLocalSet, 1,
+      kExprLocalGet, 1, kExprLocalGet, 0, kExprF64Sub,
+    ])
+    .exportFunc();
+  builder.addFunction("i64_shl", kSig_l_ll)
+    .addBody([
+      kExprLocalGet, 0, kExprLocalGet, 1, kExprI64Shl,
+      kExprLocalSet, 1,
+      kExprLocalGet, 1,
+    ])
+    .exportFunc();
+  const instance = builder.instantiate();
+
+  function accumulate(start, end) {
+    let acc = 0;
+    for (let i = start; i < end; i++) {
+      acc = (acc + i * 3) | 0;
+      acc = acc ^ (acc >>> 3);
+    }
+    return acc;
+  }
+  assertEquals(accumulate(0, 100), instance.exports.accumulate(0, 100));
+  assertEquals(accumulate(5, 6), instance.exports.accumulate(5, 6));
+  assertEquals(-7, instance.exports.shared_slot(3, 7));
+  assertEquals(10.5 - 1.5, instance.exports.f64_mul(1.5, 7));
+  assertEquals(3n << 40n, instance.exports.i64_shl(3n, 40n));
+})();
@@ -3269,6 +3269,39 @@ TEST_F(AssemblerX64Test, AssemblerX64AVXVNNIINT8) {
   CHECK_EQ(0, memcmp(expected, desc.buffer, sizeof(expected)));
 }
 
+TEST_F(AssemblerX64Test, AssemblerX64AVX512) {
+  if (!CpuFeatures::IsSupported(AVX512)) return;
+
+  auto buffer = AllocateAssemblerBuffer();
+  Isolate* isolate = i_isolate();
+  Assembler masm(AssemblerOptions{}, buffer->CreateView());
+  CpuFeatureScope fscope(&masm, AVX512);
+
+  __ vpsraq(xmm1, xmm2, 5);
+  __ vpsraq(ymm1, ymm2, 5);
+  __ vpsraq(xmm1, xmm1, xmm2);
+  __ vpsraq(ymm1, ymm9, xmm8);
+
+  CodeDesc desc;
+  masm.GetCode(isolate, &desc);
+#ifdef OBJECT_PRINT
+  DirectHandle<Code> code =
+      Factory::CodeBuilder(isolate, desc, CodeKind::FOR_TESTING).Build();
+  StdoutStream os;
+  Print(*code, os);
+#endif
+
+  uint8_t expected[] = {// vpsraq xmm1, xmm2, 5
+                        0x62, 0xf1, 0xf5, 0x08, 0x72, 0xe2, 0x05,
+                        // vpsraq ymm1, ymm2, 5
+                        0x62, 0xf1, 0xf5, 0x28, 0x72, 0xe2, 0x05,
+                        // vpsraq xmm1, xmm1, xmm2
+                        0x62, 0xf1, 0xf5, 0x08, 0xe2, 0xca,
+                        // vpsraq ymm1, ymm9, xmm8
+                        0x62, 0xd1, 0xb5, 0x28, 0xe2, 0xc8};
+  CHECK_EQ(0, memcmp(expected, desc.buffer, sizeof(expected)));
+}
+
 TEST_F(AssemblerX64Test, CpuFeatures_ProbeImpl) {
   // Support for a newer extension implies support for the older extensions.
   CHECK_IMPLIES(CpuFeatures::IsSupported(FMA3), CpuFeatures::IsSupported(AVX));
@@ -3276,6 +3309,8 @@ TEST_F(AssemblerX64Test, CpuFeatures_ProbeImpl) {
                 CpuFeatures::IsSupported(AVX));
   CHECK_IMPLIES(CpuFeatures::IsSupported(AVX_VNNI),
                 CpuFeatures::IsSupported(AVX));
+  CHECK_IMPLIES(CpuFeatures::IsSupported(AVX512),
+                CpuFeatures::IsSupported(AVX2));
   CHECK_IMPLIES(CpuFeatures::IsSupported(AVX2), CpuFeatures::IsSupported(AVX));
   CHECK_IMPLIES(CpuFeatures::IsSupported(AVX),
                 CpuFeatures::IsSupported(SSE4_2));
@@ -3298,6 +3333,8 @@ TEST_F(AssemblerX64Test, CpuFeatures_ProbeImpl) {
                 !CpuFeatures::IsSupported(AVX));
   CHECK_IMPLIES(!CpuFeatures::IsSupported(AVX),
                 !CpuFeatures::IsSupported(AVX2));
+  CHECK_IMPLIES(!CpuFeatures::IsSupported(AVX2),
+                !CpuFeatures::IsSupported(AVX512));
   CHECK_IMPLIES(!CpuFeatures::IsSupported(AVX),
                 !CpuFeatures::IsSupported(AVX_VNNI));
   CHECK_IMPLIES(!CpuFeatures::IsSupported(AVX),
@@ -1458,6 +1458,21 @@ TEST_F(DisasmX64Test, DisasmX64CheckOutputVNNI) {
           vpdpbusd(ymm8, ymm11, ymm7));
 }
 
+TEST_F(DisasmX64Test, DisasmX64CheckOutputAVX512) {
+  if (!CpuFeatures::IsSupported(AVX512)) {
+    return;
+  }
+
+  DisassemblerTester t;
+  CpuFeatureScope scope(&t.assm_, AVX512);
+  COMPARE("62f1f50872e205       vpsraq xmm1,xmm2,5", vpsraq(xmm1, xmm2, 5));
+  COMPARE("62f1f52872e205       vpsraq ymm1,ymm2,5", vpsraq(ymm1, ymm2, 5));
+  COMPARE("62f1f508e2ca         vpsraq xmm1,xmm1,xmm2",
+          vpsraq(xmm1, xmm1, xmm2));
+  COMPARE("62d1b528e2c8         vpsraq ymm1,ymm9,xmm8",
+          vpsraq(ymm1, ymm9, xmm8));
+}
+
 TEST_F(DisasmX64Test, DisasmX64CheckOutputF16C) {
   if (!CpuFeatures::IsSupported(F16C)) {
     return;
@@ -96,5 +96,99 @@ TEST_F(OptimizingCompileDispatcherTest, NonBlockingFlush) {
   dispatcher.Stop();
 }
 
+TEST_F(OptimizingCompileDispatcherTest, PrioritizedQueue) {
+  Handle<JSFunction> fun =
+      RunJS<JSFunction>("function f() { function g() {}; return g;}; f();");
+  IsCompiledScope is_compiled_scope;
+  ASSERT_TRUE(Compiler::Compile(i_isolate(), fun, Compiler::CLEAR_EXCEPTION,
+                                &is_compiled_scope));
+  auto low = std::make_unique<BlockingCompilationJob>(i_isolate(), fun);
+  auto mid = std::make_unique<BlockingCompilationJob>(i_isolate(), fun);
+  auto mid2 = std::make_unique<BlockingCompilationJob>(i_isolate(), fun);
+  auto high = std::make_unique<BlockingCompilationJob>(i_isolate(), fun);
+
+  base::TimeTicks now = base::TimeTicks::Now();
+  OptimizingCompileDispatcherQueue queue(4, true);
+  queue.Enqueue(low.get(), 1, now);
+  queue.Enqueue(mid.get(), 2, now);
+  queue.Enqueue(high.get(), 3, now);
+  queue.Enqueue(mid2.get(), 2, now);
+  ASSERT_FALSE(queue.IsAvailable());
+
+  // Highest benefit first, FIFO among equal benefits.
+  ASSERT_EQ(high.get(), queue.Dequeue(nullptr, now));
+  ASSERT_EQ(mid.get(), queue.Dequeue(nullptr, now));
+  ASSERT_EQ(mid2.get(), queue.Dequeue(nullptr, now));
+  ASSERT_EQ(low.get(), queue.Dequeue(nullptr, now));
+  ASSERT_EQ(nullptr, queue.Dequeue(nullptr, now));
+}
+
+TEST_F(OptimizingCompileDispatcherTest, PrioritizedQueueAging) {
+  Handle<JSFunction> fun =
+      RunJS<JSFunction>("function f() { function g() {}; return g;}; f();");
+  IsCompiledScope is_compiled_scope;
+  ASSERT_TRUE(Compiler::Compile(i_isolate(), fun, Compiler::CLEAR_EXCEPTION,
+                                &is_compiled_scope));
+  auto old_low = std::make_unique<BlockingCompilationJob>(i_isolate(), fun);
+  auto new_high = std::make_unique<BlockingCompilationJob>(i_isolate(), fun);
+
+  base::TimeTicks now = base::TimeTicks::Now();
+  base::TimeDelta aging_time = base::TimeDelta::FromMilliseconds(
+      OptimizingCompileDispatcherQueue::kBenefitAgingTimeMs);
+  OptimizingCompileDispatcherQueue queue(2, true);
+  // After waiting for three aging periods, a job of benefit 1 outranks a
+  // fresh job of benefit 3.
+  queue.Enqueue(old_low.get(), 1, now);
+  queue.Enqueue(new_high.get(), 3, now + aging_time * 3);
+  base::TimeTicks later = now + aging_time * 3 + aging_time / 10;
+  base::TimeDelta queued_time;
+  ASSERT_EQ(old_low.get(), queue.Dequeue(&queued_time, later));
+  ASSERT_EQ(later - now, queued_time);
+  ASSERT_EQ(new_high.get(), queue.Dequeue(nullptr, later));
+  ASSERT_EQ(nullptr, queue.Dequeue(nullptr, later));
+}
+
+TEST_F(OptimizingCompileDispatcherTest, PrioritizedQueueDropsColdJobs) {
+  Handle<JSFunction> fun =
+      RunJS<JSFunction>("function f() { function g() {}; return g;}; f();");
+  IsCompiledScope is_compiled_scope;
+  ASSERT_TRUE(Compiler::Compile(i_isolate(), fun, Compiler::CLEAR_EXCEPTION,
+                                &is_compiled_scope));
+  // Dropped jobs are deleted by the queue.
+  BlockingCompilationJob* cold = new BlockingCompilationJob(i_isolate(), fun);
+
+  base::TimeTicks now = base::TimeTicks::Now();
+  base::TimeDelta cold_time = base::TimeDelta::FromMilliseconds(
+      OptimizingCompileDispatcherQueue::kColdTimeMs);
+  OptimizingCompileDispatcherQueue queue(1, true);
+  queue.Enqueue(cold, 1, now);
+  queue.UpdateBenefits(i_isolate(), now + cold_time / 2);
+  ASSERT_EQ(1, queue.Length());
+  queue.UpdateBenefits(i_isolate(), now + cold_time);
+  ASSERT_EQ(0, queue.Length());
+  ASSERT_EQ(nullptr, queue.Dequeue());
+}
+
+TEST_F(OptimizingCompileDispatcherTest, FifoQueue) {
+  Handle<JSFunction> fun =
+      RunJS<JSFunction>("function f() { function g() {}; return g;}; f();");
+  IsCompiledScope is_compiled_scope;
+  ASSERT_TRUE(Compiler::Compile(i_isolate(), fun, Compiler::CLEAR_EXCEPTION,
+                                &is_compiled_scope));
+  auto first = std::make_unique<BlockingCompilationJob>(i_isolate(), fun);
+  auto second = std::make_unique<BlockingCompilationJob>(i_isolate(), fun);
+
+  OptimizingCompileDispatcherQueue queue(2);
+  queue.Enqueue(first.get(), 1);
+  queue.Enqueue(second.get(), 2);
+
+  // Benefits are ignored without prioritization.
+  base::TimeDelta queued_time;
+  ASSERT_EQ(first.get(), queue.Dequeue(&queued_time));
+  ASSERT_LE(base::TimeDelta(), queued_time);
+  ASSERT_EQ(second.get(), queue.Dequeue());
+  ASSERT_EQ(nullptr, queue.Dequeue());
+}
+
 }  // namespace internal
 }  // namespace v8
@@ -0,0 +1,46 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifdef V8_ENABLE_MAGLEV
+
+#include "src/maglev/maglev-regalloc.h"
+
+#include "test/unittests/maglev/maglev-test.h"
+
+namespace v8 {
+namespace internal {
+namespace maglev {
+
+namespace {
+
+int Distance(int next_use, bool is_loadable) {
+  constexpr int kCurrentId = 10;
+  return StraightForwardRegisterAllocator::EvictionDistance(
+      next_use, kCurrentId, is_loadable);
+}
+
+}  // namespace
+
+// Without a difference in cost, the value used furthest away is evicted.
+TEST_F(MaglevTest, RegallocEvictsFurthestUse) {
+  EXPECT_GT(Distance(40, false), Distance(20, false));
+  EXPECT_GT(Distance(40, true), Distance(20, true));
+}
+
+// A value that can be dropped without a spill store is evicted in favour of
+// one that is used somewhat later but would have to be spilled.
+TEST_F(MaglevTest, RegallocPrefersEvictingLoadableValues) {
+  EXPECT_GT(Distance(30, true), Distance(45, false));
+}
+
+// ... but not in favour of one that is used much later.
+TEST_F(MaglevTest, RegallocDoesNotEvictLoadableValuesNeededSoon) {
+  EXPECT_LT(Distance(15, true), Distance(45, false));
+}
+
+}  // namespace maglev
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_ENABLE_MAGLEV
@@ -25,5 +25,46 @@ TEST_F(ZoneTest, 8ByteAlignment) {
   }
 }
 
+TEST_F(ZoneTest, SegmentPool) {
+  AccountingAllocator allocator;
+  allocator.ConfigureSegmentPool(64 * KB);
+
+  void* first_allocation;
+  {
+    Zone zone(&allocator, ZONE_NAME);
+    first_allocation = zone.Allocate<ZoneTestTag>(16);
+    EXPECT_LT(0u, allocator.GetCurrentMemoryUsage());
+    EXPECT_EQ(0u, allocator.GetPooledMemory());
+  }
+  // The segment of the dead zone was pooled instead of being freed.
+  EXPECT_EQ(0u, allocator.GetCurrentMemoryUsage());
+  size_t pooled = allocator.GetPooledMemory();
+  EXPECT_LT(0u, pooled);
+
+  {
+    // A new zone of the same size reuses the pooled segment.
+    Zone zone(&allocator, ZONE_NAME);
+    EXPECT_EQ(first_allocation, zone.Allocate<ZoneTestTag>(16));
+    EXPECT_EQ(0u, allocator.GetPooledMemory());
+    EXPECT_EQ(pooled, allocator.GetCurrentMemoryUsage());
+  }
+
+  allocator.ReleasePooledSegments();
+  EXPECT_EQ(0u, allocator.GetPooledMemory());
+  EXPECT_EQ(0u, allocator.GetCurrentMemoryUsage());
+}
+
+TEST_F(ZoneTest, SegmentPoolLimit) {
+  AccountingAllocator allocator;
+  allocator.ConfigureSegmentPool(8 * KB);
+  {
+    Zone zone(&allocator, ZONE_NAME);
+    // Allocate enough to require several segments.
+    for (int i = 0; i < 8; ++i) zone.Allocate<ZoneTestTag>(4 * KB);
+  }
+  EXPECT_LE(allocator.GetPooledMemory(), 8 * KB);
+  EXPECT_EQ(0u, allocator.GetCurrentMemoryUsage());
+}
+
 }  // namespace internal
 }  // namespace v8